@@ -96,6 +96,14 @@ public:
             _size = n;
         }
 
+        void expand(size_type n) // Ensures capacity for n more bytes, never shrinks.
+        {
+            if(_size + n > _capacity)
+            {
+                reserve(_size + n);
+            }
+        }
+
         void reset()
         {
             if(_size > 0 && _size * 2 < _capacity)
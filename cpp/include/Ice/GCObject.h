@@ -44,6 +44,14 @@ public:
     static const unsigned char CycleMember;
     static const unsigned char Visiting;
 
+    GCObject();
+    GCObject(const GCObject&);
+
+    GCObject& operator=(const GCObject&)
+    {
+        return *this;
+    }
+
     //
     // Override IceUtil::Shared methods
     //
@@ -56,6 +64,14 @@ public:
     // Override Object methods
     //
     virtual bool __gcVisit(GCVisitor&);
+
+    //
+    // Enables or disables the collection of the graph of this object.
+    // It must be called before the objects of the graph are shared with
+    // other threads: __incRef and __decRef only lock the GC mutex for
+    // collectable objects, the reference count of an object must not be
+    // updated by another thread while its Collectable flag changes.
+    //
     virtual void ice_collectable(bool);
 
     //
@@ -69,9 +85,21 @@ public:
         return _ref;
     }
 
+    //
+    // Sets or clears the Collectable flag, must be called with the GC
+    // mutex locked.
+    //
+    void __setCollectable(bool);
+
 private:
 
     bool collect(IceUtilInternal::MutexPtrLock<IceUtil::Mutex>&);
+
+    //
+    // Mirrors the Collectable flag, it's read without the GC mutex by
+    // __incRef and __decRef.
+    //
+    IceUtilInternal::Atomic _collectable;
 };
 
 }
@@ -737,18 +737,30 @@ private:
     protected:
 
         EncapsDecoder(InputStream* stream, Encaps* encaps, bool sliceValues, const Ice::ValueFactoryManagerPtr& f) :
-            _stream(stream), _encaps(encaps), _sliceValues(sliceValues), _valueFactoryManager(f), _typeIdIndex(0)
+            _stream(stream), _encaps(encaps), _sliceValues(sliceValues), _valueFactoryManager(f),
+            _defaultFactoryResolved(false)
         {
         }
 
-        std::string readTypeId(bool);
+        const std::string& readTypeId(bool);
         ValuePtr newInstance(const std::string&);
 
         void addPatchEntry(Int, PatchFunc, void*);
         void unmarshal(Int, const ValuePtr&);
 
-        typedef std::map<Int, ValuePtr> IndexToPtrMap;
-        typedef std::map<Int, std::string> TypeIdMap;
+        //
+        // Instance and type ID indexes are allocated sequentially
+        // starting at 1, so they are looked up by position.
+        //
+        typedef std::vector<ValuePtr> IndexToPtrList;
+        typedef std::vector<std::string> TypeIdList;
+
+        struct ValueFactories
+        {
+            ICE_VALUE_FACTORY userFactory;
+            ICE_VALUE_FACTORY staticFactory;
+        };
+        typedef std::map<std::string, ValueFactories> ValueFactoryCache;
 
         struct PatchEntry
         {
@@ -769,10 +781,14 @@ private:
     private:
 
         // Encapsulation attributes for object un-marshalling
-        IndexToPtrMap _unmarshaledMap;
-        TypeIdMap _typeIdMap;
-        Int _typeIdIndex;
+        IndexToPtrList _unmarshaledList;
+        TypeIdList _typeIdList;
         ValueList _valueList;
+
+        // Factories resolved for the type IDs of this encapsulation
+        ValueFactoryCache _valueFactoryCache;
+        ICE_VALUE_FACTORY _defaultFactory;
+        bool _defaultFactoryResolved;
     };
 
     class ICE_API EncapsDecoder10 : public EncapsDecoder
@@ -98,6 +98,15 @@ public:
         b.resize(sz);
     }
 
+    //
+    // Reserve room for sz more bytes, so that writing data whose size
+    // is known in advance doesn't reallocate the buffer several times.
+    //
+    void reserve(Container::size_type sz)
+    {
+        b.expand(sz);
+    }
+
     void startValue(const SlicedDataPtr& data)
     {
         assert(_currentEncaps && _currentEncaps->encoder);
@@ -12,6 +12,8 @@
 
 #include <Ice/ObjectF.h>
 
+#include <algorithm>
+
 #ifndef ICE_CPP11_MAPPING
 #   include <IceUtil/ScopedArray.h>
 #   include <IceUtil/Iterator.h>
@@ -94,6 +96,53 @@ struct IsMap
     static const bool value = IsContainer<T>::value && sizeof(test<T>(0)) == sizeof(char);
 };
 
+//
+// Does the provided type have an allocator?
+// For now, the implementation only checks if there is a T::allocator_type typedef
+// using SFINAE. A container with an allocator_type typedef must, like the standard
+// containers, provide get_allocator() and a constructor that takes an allocator.
+//
+template<typename T>
+struct HasAllocator
+{
+    template<typename C>
+    static char test(typename C::allocator_type*);
+
+    template<typename C>
+    static long test(...);
+
+    static const bool value = sizeof(test<T>(0)) == sizeof(char);
+};
+
+//
+// Is the provided type a struct whose in-memory representation matches
+// its little-endian encoding? slice2cpp generates specializations for
+// structs with only fixed-size numeric data members and no padding.
+//
+template<typename T>
+struct IsBulkStreamable
+{
+    static const bool value = false;
+};
+
+//
+// Is the provided type a vector of IsBulkStreamable elements that can be
+// marshaled with a single copy?
+//
+template<typename T>
+struct IsBulkStreamableSequence
+{
+    static const bool value = false;
+};
+
+#ifndef ICE_BIG_ENDIAN
+template<typename T, typename A>
+struct IsBulkStreamableSequence< ::std::vector<T, A> >
+{
+    static const bool value = IsBulkStreamable<T>::value;
+};
+#endif
+
 #ifdef ICE_CPP11_MAPPING
 
 //
@@ -384,20 +433,62 @@ struct StreamReader
     }
 };
 
+// Struct helper, delegates to the generated StreamWriter/StreamReader
+template<typename T, bool bulk>
+struct StreamStructHelper
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        StreamWriter<T, S>::write(stream, v);
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        StreamReader<T, S>::read(stream, v);
+    }
+};
+
+// Struct helper for IsBulkStreamable types, copies all the data members at once
+template<typename T>
+struct StreamStructHelper<T, true>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        stream->writeBlob(reinterpret_cast<const Byte*>(&v), sizeof(T));
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        const Byte* p;
+        stream->readBlob(p, sizeof(T));
+        ::std::copy(p, p + sizeof(T), reinterpret_cast<Byte*>(&v));
+    }
+};
+
 // Helper for structs
 template<typename T>
 struct StreamHelper<T, StreamHelperCategoryStruct>
 {
+#ifdef ICE_BIG_ENDIAN
+    static const bool bulk = false;
+#else
+    static const bool bulk = IsBulkStreamable<T>::value;
+#endif
+
     template<class S> static inline void
     write(S* stream, const T& v)
     {
-        StreamWriter<T, S>::write(stream, v);
+        StreamStructHelper<T, bulk>::write(stream, v);
     }
 
     template<class S> static inline void
     read(S* stream, T& v)
     {
-        StreamReader<T, S>::read(stream, v);
+        StreamStructHelper<T, bulk>::read(stream, v);
     }
 };
 
@@ -445,14 +536,43 @@ struct StreamHelper<T, StreamHelperCategoryEnum>
     }
 };
 
-// Helper for sequences
+//
+// Replaces the elements of a sequence with the given number of default
+// elements. The allocator of the sequence is preserved, sequences mapped
+// with cpp:type to a container with a stateful allocator (for example
+// an arena allocator scoped to a dispatch) unmarshal their elements with
+// that allocator. Containers without an allocator_type typedef use the
+// size constructor and swap.
+//
+template<typename T, bool hasAllocator>
+struct StreamSequenceInitializer
+{
+    static inline void init(T& v, Int sz)
+    {
+        T(sz).swap(v);
+    }
+};
+
 template<typename T>
-struct StreamHelper<T, StreamHelperCategorySequence>
+struct StreamSequenceInitializer<T, true>
+{
+    static inline void init(T& v, Int sz)
+    {
+        T tmp(v.get_allocator());
+        tmp.resize(sz);
+        tmp.swap(v);
+    }
+};
+
+// Sequence helper, marshals the elements one by one
+template<typename T, bool bulk>
+struct StreamSequenceHelper
 {
     template<class S> static inline void
     write(S* stream, const T& v)
     {
         stream->writeSize(static_cast<Int>(v.size()));
+        stream->reserve(v.size() * StreamableTraits<typename T::value_type>::minWireSize);
         for(typename T::const_iterator p = v.begin(); p != v.end(); ++p)
         {
             stream->write(*p);
@@ -463,7 +583,7 @@ struct StreamHelper<T, StreamHelperCategorySequence>
     read(S* stream, T& v)
     {
         Int sz = stream->readAndCheckSeqSize(StreamableTraits<typename T::value_type>::minWireSize);
-        T(sz).swap(v);
+        StreamSequenceInitializer<T, HasAllocator<T>::value>::init(v, sz);
         for(typename T::iterator p = v.begin(); p != v.end(); ++p)
         {
             stream->read(*p);
@@ -471,6 +591,86 @@ struct StreamHelper<T, StreamHelperCategorySequence>
     }
 };
 
+// Sequence helper for IsBulkStreamableSequence types, copies all the elements at once
+template<typename T>
+struct StreamSequenceHelper<T, true>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        stream->writeSize(static_cast<Int>(v.size()));
+        if(!v.empty())
+        {
+            stream->writeBlob(reinterpret_cast<const Byte*>(&v[0]), v.size() * sizeof(typename T::value_type));
+        }
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<typename T::value_type>::minWireSize);
+        v.resize(sz);
+        if(sz > 0)
+        {
+            const Byte* p;
+            stream->readBlob(p, sz * sizeof(typename T::value_type));
+            ::std::copy(p, p + sz * sizeof(typename T::value_type), reinterpret_cast<Byte*>(&v[0]));
+        }
+    }
+};
+
+// Helper for sequences
+template<typename T>
+struct StreamHelper<T, StreamHelperCategorySequence>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        StreamSequenceHelper<T, IsBulkStreamableSequence<T>::value>::write(stream, v);
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        StreamSequenceHelper<T, IsBulkStreamableSequence<T>::value>::read(stream, v);
+    }
+};
+
+// Array helper, delegates read/write to the stream
+template<typename T, bool bulk>
+struct StreamArrayHelper
+{
+    template<class S> static inline void
+    read(S* stream, std::pair<const T*, const T*>& v)
+    {
+        stream->read(v);
+    }
+};
+
+#if defined(ICE_UNALIGNED) && !defined(ICE_BIG_ENDIAN)
+// Array helper for IsBulkStreamable types, the array points to the stream buffer
+template<typename T>
+struct StreamArrayHelper<T, true>
+{
+    template<class S> static inline void
+    read(S* stream, std::pair<const T*, const T*>& v)
+    {
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<T>::minWireSize);
+        if(sz > 0)
+        {
+            const Byte* p;
+            stream->readBlob(p, sz * sizeof(T));
+            v.first = reinterpret_cast<const T*>(p);
+            v.second = v.first + sz;
+        }
+        else
+        {
+            v.first = v.second = 0;
+        }
+    }
+};
+#endif
+
 // Helper for array custom sequence parameters
 template<typename T>
 struct StreamHelper<std::pair<const T*, const T*>, StreamHelperCategorySequence>
@@ -484,7 +684,7 @@ struct StreamHelper<std::pair<const T*, const T*>, StreamHelperCategorySequence>
     template<class S> static inline void
     read(S* stream, std::pair<const T*, const T*>& v)
     {
-        stream->read(v);
+        StreamArrayHelper<T, IsBulkStreamable<T>::value>::read(stream, v);
     }
 };
 
@@ -550,6 +750,8 @@ struct StreamHelper<T, StreamHelperCategoryDictionary>
     write(S* stream, const T& v)
     {
         stream->writeSize(static_cast<Int>(v.size()));
+        stream->reserve(v.size() * (StreamableTraits<typename T::key_type>::minWireSize +
+                                    StreamableTraits<typename T::mapped_type>::minWireSize));
         for(typename T::const_iterator p = v.begin(); p != v.end(); ++p)
         {
             stream->write(p->first);
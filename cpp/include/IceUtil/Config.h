@@ -64,6 +64,15 @@
 
 #endif
 
+//
+// Unaligned loads and stores of numeric types are supported.
+//
+#ifndef ICE_UNALIGNED
+#   if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64)
+#       define ICE_UNALIGNED
+#   endif
+#endif
+
 #ifdef _MSC_VER
 
 #   ifdef _WIN64
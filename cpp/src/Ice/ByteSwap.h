@@ -0,0 +1,94 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2016 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_BYTE_SWAP_H
+#define ICE_BYTE_SWAP_H
+
+#include <Ice/Config.h>
+#include <string.h>
+
+//
+// Helpers to convert sequences of numeric values between the
+// little-endian encoding and the byte order of big-endian hosts. The
+// values are swapped a whole word at a time rather than byte by byte,
+// which compilers turn into native byte-swap (and vector) instructions.
+//
+namespace IceInternal
+{
+
+inline unsigned short
+byteSwap(unsigned short v)
+{
+    return static_cast<unsigned short>((v >> 8) | (v << 8));
+}
+
+inline unsigned int
+byteSwap(unsigned int v)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap32(v);
+#else
+    return (v >> 24) | ((v >> 8) & 0x0000ff00) | ((v << 8) & 0x00ff0000) | (v << 24);
+#endif
+}
+
+template<typename T> inline void
+byteSwapCopy(const Ice::Byte* src, Ice::Byte* dest, Ice::Int sz)
+{
+    for(Ice::Int j = 0; j < sz; ++j)
+    {
+        T v;
+        memcpy(&v, src, sizeof(T));
+        v = byteSwap(v);
+        memcpy(dest, &v, sizeof(T));
+        src += sizeof(T);
+        dest += sizeof(T);
+    }
+}
+
+//
+// 2 bytes values (Short)
+//
+inline void
+byteSwapCopy2(const Ice::Byte* src, Ice::Byte* dest, Ice::Int sz)
+{
+    byteSwapCopy<unsigned short>(src, dest, sz);
+}
+
+//
+// 4 bytes values (Int, Float)
+//
+inline void
+byteSwapCopy4(const Ice::Byte* src, Ice::Byte* dest, Ice::Int sz)
+{
+    byteSwapCopy<unsigned int>(src, dest, sz);
+}
+
+//
+// 8 bytes values (Long, Double), swapped as two 4 bytes words
+//
+inline void
+byteSwapCopy8(const Ice::Byte* src, Ice::Byte* dest, Ice::Int sz)
+{
+    for(Ice::Int j = 0; j < sz; ++j)
+    {
+        unsigned int v[2];
+        memcpy(v, src, sizeof(v));
+        unsigned int high = byteSwap(v[0]);
+        v[0] = byteSwap(v[1]);
+        v[1] = high;
+        memcpy(dest, v, sizeof(v));
+        src += sizeof(v);
+        dest += sizeof(v);
+    }
+}
+
+}
+
+#endif
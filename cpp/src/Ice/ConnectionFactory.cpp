@@ -77,20 +77,6 @@ remove(Map& m, const typename Map::key_type& k, const typename Map::mapped_type&
     assert(false); // Nothing was removed which is an error.
 }
 
-template<typename Map, typename Predicate> typename Map::mapped_type
-find(const Map& m, const typename Map::key_type& k, Predicate predicate)
-{
-    auto pr = m.equal_range(k);
-    for(auto q = pr.first; q != pr.second; ++q)
-    {
-        if(predicate(q->second))
-        {
-            return q->second;
-        }
-    }
-    return nullptr;
-}
-
 #else
 template <typename K, typename V> void
 remove(multimap<K, V>& m, K k, V v)
@@ -107,24 +93,34 @@ remove(multimap<K, V>& m, K k, V v)
     }
     assert(false); // Nothing was removed which is an error.
 }
+#endif
 
-template <typename K, typename V> ::IceInternal::Handle<V>
-find(const multimap<K,::IceInternal::Handle<V> >& m,
-     K k,
-     const ::IceUtilInternal::ConstMemFun<bool, V, ::IceInternal::Handle<V> >& predicate)
+//
+// Returns the active or holding connection with the fewest outstanding
+// requests and the number of active or holding connections for the key.
+//
+template<typename Map> typename Map::mapped_type
+findLeastLoaded(const Map& m, const typename Map::key_type& k, size_t& count)
 {
-    pair<typename multimap<K, ::IceInternal::Handle<V> >::const_iterator,
-         typename multimap<K, ::IceInternal::Handle<V> >::const_iterator> pr = m.equal_range(k);
-    for(typename multimap<K, ::IceInternal::Handle<V> >::const_iterator q = pr.first; q != pr.second; ++q)
+    pair<typename Map::const_iterator, typename Map::const_iterator> pr = m.equal_range(k);
+    typename Map::mapped_type connection;
+    size_t requests = 0;
+    count = 0;
+    for(typename Map::const_iterator q = pr.first; q != pr.second; ++q)
     {
-        if(predicate(q->second))
+        if(q->second->isActiveOrHolding())
         {
-            return q->second;
+            size_t n = q->second->getOutstandingRequestCount();
+            if(!connection || n < requests)
+            {
+                connection = q->second;
+                requests = n;
+            }
+            ++count;
         }
     }
-    return IceInternal::Handle<V>();
+    return connection;
 }
-#endif
 
 }
 
@@ -395,9 +391,19 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
     assert(!endpoints.empty());
     for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
     {
-        ConnectionIPtr connection = find(_connectionsByEndpoint, *p, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+        size_t count;
+        ConnectionIPtr connection = findLeastLoaded(_connectionsByEndpoint, *p, count);
         if(connection)
         {
+            if(count < defaultsAndOverrides->defaultConnectionPoolSize)
+            {
+                //
+                // The pool isn't full, the connectors lookup establishes
+                // another connection.
+                //
+                return 0;
+            }
+
             if(defaultsAndOverrides->overrideCompress)
             {
                 compress = defaultsAndOverrides->overrideCompressValue;
@@ -420,12 +426,24 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInf
     DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
     for(vector<ConnectorInfo>::const_iterator p = connectors.begin(); p != connectors.end(); ++p)
     {
+        size_t count;
+        ConnectionIPtr connection = findLeastLoaded(_connections, p->connector, count);
         if(_pending.find(p->connector) != _pending.end())
         {
-            continue;
+            //
+            // Use the pooled connections while another connection to
+            // this connector is being established.
+            //
+            if(!connection)
+            {
+                continue;
+            }
+        }
+        else if(connection && count < defaultsAndOverrides->defaultConnectionPoolSize)
+        {
+            return 0;
         }
 
-        ConnectionIPtr connection = find(_connections, p->connector, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
         if(connection)
         {
             if(defaultsAndOverrides->overrideCompress)
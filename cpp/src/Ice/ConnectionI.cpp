@@ -144,6 +144,35 @@ ConnectionState connectionStateMap[] = {
     ConnectionStateClosed,       // StateFinished
 };
 
+//
+// Heartbeats and small replies are queued ahead of other queued
+// messages to avoid head-of-line blocking behind large messages. The
+// protocol only requires requests to be sent in order, replies are
+// matched with their request ID.
+//
+const Buffer::Container::size_type priorityMessageSizeMax = 16 * 1024;
+
+bool
+isPriorityMessage(const OutputStream& stream)
+{
+    assert(stream.b.size() >= headerSize);
+    switch(stream.b[8])
+    {
+    case validateConnectionMsg:
+    {
+        return true;
+    }
+    case replyMsg:
+    {
+        return stream.b.size() <= priorityMessageSizeMax;
+    }
+    default:
+    {
+        return false;
+    }
+    }
+}
+
 }
 
 Ice::ConnectionI::Observer::Observer() : _readStreamPos(0), _writeStreamPos(0)
@@ -448,6 +477,13 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+size_t
+Ice::ConnectionI::getOutstandingRequestCount() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    return _asyncRequests.size();
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -2674,8 +2710,21 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
     if(!_sendStreams.empty())
     {
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0);
+        //
+        // The first message is being sent, priority messages are queued
+        // after it and the other queued priority messages.
+        //
+        deque<OutgoingMessage>::iterator p = _sendStreams.end();
+        if(isPriorityMessage(*message.stream))
+        {
+            p = _sendStreams.begin() + 1;
+            while(p != _sendStreams.end() && isPriorityMessage(*p->stream))
+            {
+                ++p;
+            }
+        }
+        p = _sendStreams.insert(p, message);
+        p->adopt(0);
         return AsyncStatusQueued;
     }
 
@@ -161,6 +161,7 @@ public:
 
     bool isActiveOrHolding() const;
     bool isFinished() const;
+    size_t getOutstandingRequestCount() const;
 
     void throwException() const; // Throws the connection exception if destroyed.
 
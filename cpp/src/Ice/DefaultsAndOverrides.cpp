@@ -155,6 +155,16 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
             << properties->getProperty("Ice.Default.LocatorCacheTimeout") << "': defaulting to -1";
     }
 
+    int connectionPoolSize = properties->getPropertyAsIntWithDefault("Ice.Default.ConnectionPoolSize", 1);
+    if(connectionPoolSize < 1)
+    {
+        connectionPoolSize = 1;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.ConnectionPoolSize `"
+            << properties->getProperty("Ice.Default.ConnectionPoolSize") << "': defaulting to 1";
+    }
+    const_cast<size_t&>(defaultConnectionPoolSize) = static_cast<size_t>(connectionPoolSize);
+
     const_cast<bool&>(defaultPreferSecure) =
         properties->getPropertyAsIntWithDefault("Ice.Default.PreferSecure", 0) > 0;
 
@@ -36,6 +36,7 @@ public:
     int defaultTimeout;
     int defaultInvocationTimeout;
     int defaultLocatorCacheTimeout;
+    size_t defaultConnectionPoolSize;
     bool defaultPreferSecure;
     Ice::EncodingVersion defaultEncoding;
     Ice::FormatType defaultFormat;
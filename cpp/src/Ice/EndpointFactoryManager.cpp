@@ -24,6 +24,21 @@ using namespace IceInternal;
 
 IceUtil::Shared* IceInternal::upCast(EndpointFactoryManager* p) { return p; }
 
+namespace
+{
+
+//
+// The caches of shared endpoints are cleared when they reach this size.
+//
+const size_t endpointCacheMax = 1024;
+
+//
+// Unmarshaled endpoints with a larger encoding aren't shared.
+//
+const size_t endpointKeySizeMax = 256;
+
+}
+
 IceInternal::EndpointFactoryManager::EndpointFactoryManager(const InstancePtr& instance)
     : _instance(instance)
 {
@@ -67,6 +82,103 @@ IceInternal::EndpointFactoryManager::get(Short type) const
 
 EndpointIPtr
 IceInternal::EndpointFactoryManager::create(const string& str, bool oaEndpoint) const
+{
+    //
+    // Object adapter endpoints might be expanded or updated with the
+    // bound port, they aren't shared.
+    //
+    if(oaEndpoint)
+    {
+        return parse(str, oaEndpoint);
+    }
+
+    //
+    // Endpoints are immutable, the endpoints created from the same
+    // string are shared.
+    //
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        map<string, EndpointIPtr>::const_iterator p = _stringEndpoints.find(str);
+        if(p != _stringEndpoints.end())
+        {
+            return p->second;
+        }
+    }
+
+    EndpointIPtr e = parse(str, oaEndpoint);
+    if(e)
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(_stringEndpoints.size() >= endpointCacheMax)
+        {
+            _stringEndpoints.clear();
+        }
+        _stringEndpoints.insert(make_pair(str, e));
+    }
+    return e;
+}
+
+EndpointIPtr
+IceInternal::EndpointFactoryManager::read(InputStream* s) const
+{
+    InputStream::size_type start = s->pos();
+    Short type;
+    s->read(type);
+
+    EndpointFactoryPtr factory = get(type);
+    EndpointIPtr e;
+
+    //
+    // Endpoints unmarshaled from the same bytes are shared, the key is
+    // the endpoint type and its encapsulation. Opaque endpoints and
+    // endpoints with an encoding larger than endpointKeySizeMax are
+    // provided by the peer and aren't shared.
+    //
+    vector<Byte> key;
+    if(factory)
+    {
+        InputStream::size_type encapsStart = s->pos();
+        s->skipEncapsulation();
+        if(s->pos() - start <= endpointKeySizeMax)
+        {
+            key.assign(s->b.begin() + start, s->i);
+            IceUtil::Mutex::Lock sync(*this);
+            map<vector<Byte>, EndpointIPtr>::const_iterator p = _encodedEndpoints.find(key);
+            if(p != _encodedEndpoints.end())
+            {
+                return p->second;
+            }
+        }
+        s->pos(encapsStart);
+    }
+
+    s->startEncapsulation();
+
+    if(factory)
+    {
+        e = factory->read(s);
+    }
+    else
+    {
+        e = ICE_MAKE_SHARED(OpaqueEndpointI, type, s);
+    }
+
+    s->endEncapsulation();
+
+    if(!key.empty())
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(_encodedEndpoints.size() >= endpointCacheMax)
+        {
+            _encodedEndpoints.clear();
+        }
+        _encodedEndpoints.insert(make_pair(key, e));
+    }
+    return e;
+}
+
+EndpointIPtr
+IceInternal::EndpointFactoryManager::parse(const string& str, bool oaEndpoint) const
 {
     vector<string> v;
     bool b = IceUtilInternal::splitString(str, " \t\n\r", v);
@@ -173,31 +285,6 @@ IceInternal::EndpointFactoryManager::create(const string& str, bool oaEndpoint)
     return 0;
 }
 
-EndpointIPtr
-IceInternal::EndpointFactoryManager::read(InputStream* s) const
-{
-    Short type;
-    s->read(type);
-
-    EndpointFactoryPtr factory = get(type);
-    EndpointIPtr e;
-
-    s->startEncapsulation();
-
-    if(factory)
-    {
-        e = factory->read(s);
-    }
-    else
-    {
-        e = ICE_MAKE_SHARED(OpaqueEndpointI, type, s);
-    }
-
-    s->endEncapsulation();
-
-    return e;
-}
-
 void
 IceInternal::EndpointFactoryManager::destroy()
 {
@@ -206,4 +293,8 @@ IceInternal::EndpointFactoryManager::destroy()
         _factories[i]->destroy();
     }
     _factories.clear();
+
+    IceUtil::Mutex::Lock sync(*this);
+    _stringEndpoints.clear();
+    _encodedEndpoints.clear();
 }
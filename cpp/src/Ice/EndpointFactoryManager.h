@@ -17,6 +17,8 @@
 #include <Ice/EndpointFactoryF.h>
 #include <Ice/EndpointFactoryManagerF.h>
 
+#include <map>
+
 namespace Ice
 {
 
@@ -42,8 +44,12 @@ private:
     void destroy();
     friend class Instance;
 
+    EndpointIPtr parse(const std::string&, bool) const;
+
     InstancePtr _instance;
     std::vector<EndpointFactoryPtr> _factories;
+    mutable std::map<std::string, EndpointIPtr> _stringEndpoints;
+    mutable std::map<std::vector<Ice::Byte>, EndpointIPtr> _encodedEndpoints;
 };
 
 }
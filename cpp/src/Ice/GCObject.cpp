@@ -228,7 +228,7 @@ MarkCollectable::visit(GCObject* obj)
     {
         return false;
     }
-    obj->__setFlag(GCObject::Collectable);
+    obj->__setCollectable(true);
         
     _numbers[obj] = ++_counter;
     _p.push(obj);
@@ -289,7 +289,7 @@ ClearCollectable::visit(GCObject* obj)
     //
     if(obj->__hasFlag(GCObject::Collectable))
     {
-        obj->__clearFlag(GCObject::Collectable | GCObject::CycleMember);
+        obj->__setCollectable(false);
         obj->__gcVisitMembers(*this);
     }
     return false;
@@ -305,9 +305,37 @@ const unsigned char GCObject::Visiting = 8;
 //
 // GCObject
 //
+IceInternal::GCObject::GCObject() :
+    _collectable(0)
+{
+}
+
+IceInternal::GCObject::GCObject(const GCObject&) :
+    Ice::Object(),
+    _collectable(0)
+{
+}
+
+//
+// The reference counts of the objects of a collectable graph must be
+// updated under the GC mutex: collect() relies on a stable view of the
+// counts of all the objects it visits, not only the cycle members. The
+// reference count is atomic, objects which aren't collectable use the
+// same lock-free reference counting as IceUtil::Shared. ice_collectable
+// is called before the graph is shared with other threads, so an
+// object can't become collectable while another thread updates its
+// reference count without the mutex.
+//
 void
 IceInternal::GCObject::__incRef()
 {
+    if(_collectable == 0)
+    {
+        assert(_ref >= 0);
+        ++_ref;
+        return;
+    }
+
     IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(gcMutex);
     ++_ref;
 }
@@ -315,6 +343,16 @@ IceInternal::GCObject::__incRef()
 void
 IceInternal::GCObject::__decRef()
 {
+    if(_collectable == 0)
+    {
+        assert(_ref > 0);
+        if(--_ref == 0 && !__hasFlag(NoDelete))
+        {
+            delete this;
+        }
+        return;
+    }
+
     IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(gcMutex);
     bool doDelete = false;
     assert(_ref > 0);
@@ -344,7 +382,6 @@ IceInternal::GCObject::__decRef()
 int
 IceInternal::GCObject::__getRef() const
 {
-    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> lock(gcMutex);
     return _ref;
 }
 
@@ -355,6 +392,21 @@ IceInternal::GCObject::__setNoDelete(bool b)
     IceUtil::Shared::__setNoDelete(b);
 }
 
+void
+IceInternal::GCObject::__setCollectable(bool b)
+{
+    if(b)
+    {
+        __setFlag(Collectable);
+        _collectable.exchange(1);
+    }
+    else
+    {
+        __clearFlag(Collectable | CycleMember);
+        _collectable.exchange(0);
+    }
+}
+
 bool
 GCObject::__gcVisit(GCVisitor& v)
 {
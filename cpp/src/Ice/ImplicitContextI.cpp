@@ -34,9 +34,21 @@ public:
     virtual void write(const Context&, ::Ice::OutputStream*) const;
     virtual void combine(const Context&, Context&) const;
 
+    SharedImplicitContext();
+
 private:
+
+    void contextChanged();
+
     Context _context;
     IceUtil::Mutex _mutex;
+
+    //
+    // The marshaled form of _context, re-used while the context isn't
+    // modified.
+    //
+    mutable std::vector<Byte> _marshaledContext;
+    mutable bool _marshaledContextValid;
 };
 
 #ifndef ICE_OS_WINRT
@@ -101,6 +113,61 @@ private:
     long _id; // corresponds to owner in the Slot
 };
 #endif
+
+//
+// Marshals the union of the proxy context and the implicit context
+// without building the combined map. Entries of the proxy context
+// take precedence, this matches Context::insert of the implicit
+// context entries into a copy of the proxy context.
+//
+void
+writeCombined(const Context& proxyCtx, const Context& ctx, ::Ice::OutputStream* s)
+{
+    Int sz = 0;
+    Context::const_iterator p = proxyCtx.begin();
+    Context::const_iterator q = ctx.begin();
+    while(p != proxyCtx.end() || q != ctx.end())
+    {
+        if(q == ctx.end() || (p != proxyCtx.end() && p->first < q->first))
+        {
+            ++p;
+        }
+        else if(p == proxyCtx.end() || q->first < p->first)
+        {
+            ++q;
+        }
+        else
+        {
+            ++p;
+            ++q;
+        }
+        ++sz;
+    }
+
+    s->writeSize(sz);
+    p = proxyCtx.begin();
+    q = ctx.begin();
+    while(p != proxyCtx.end() || q != ctx.end())
+    {
+        const Context::value_type* e;
+        if(q == ctx.end() || (p != proxyCtx.end() && p->first < q->first))
+        {
+            e = &*p++;
+        }
+        else if(p == proxyCtx.end() || q->first < p->first)
+        {
+            e = &*q++;
+        }
+        else
+        {
+            e = &*p++;
+            ++q;
+        }
+        s->write(e->first);
+        s->write(e->second);
+    }
+}
+
 }
 
 extern "C" void iceImplicitContextThreadDestructor(void*);
@@ -153,6 +220,21 @@ ImplicitContextI::cleanupThread()
 // SharedImplicitContext implementation
 //
 
+SharedImplicitContext::SharedImplicitContext() :
+    _marshaledContextValid(false)
+{
+}
+
+void
+SharedImplicitContext::contextChanged()
+{
+    //
+    // Must be called with _mutex locked.
+    //
+    _marshaledContextValid = false;
+    _marshaledContext.clear();
+}
+
 Context
 SharedImplicitContext::getContext() const
 {
@@ -165,6 +247,7 @@ SharedImplicitContext::setContext(const Context& newContext)
 {
     IceUtil::Mutex::Lock lock(_mutex);
     _context = newContext;
+    contextChanged();
 }
 
 bool
@@ -196,6 +279,7 @@ SharedImplicitContext::put(const string& k, const string& v)
 
     string oldVal = val;
     val = v;
+    contextChanged();
     return oldVal;
 }
 
@@ -212,6 +296,7 @@ SharedImplicitContext::remove(const string& k)
     {
         string oldVal = p->second;
         _context.erase(p);
+        contextChanged();
         return oldVal;
     }
 }
@@ -222,7 +307,23 @@ SharedImplicitContext::write(const Context& proxyCtx, ::Ice::OutputStream* s) co
     IceUtil::Mutex::Lock lock(_mutex);
     if(proxyCtx.size() == 0)
     {
-        s->write(_context);
+        if(_marshaledContextValid)
+        {
+            s->writeBlob(_marshaledContext);
+        }
+        else
+        {
+            //
+            // Keep a copy of the marshaled context for the next
+            // invocations, it's marshaled with the stream string
+            // converter which is the same for all the invocations of
+            // this communicator.
+            //
+            const size_t pos = s->b.size();
+            s->write(_context);
+            _marshaledContext.assign(s->b.begin() + pos, s->b.end());
+            _marshaledContextValid = true;
+        }
     }
     else if(_context.size() == 0)
     {
@@ -231,10 +332,7 @@ SharedImplicitContext::write(const Context& proxyCtx, ::Ice::OutputStream* s) co
     }
     else
     {
-        Context combined = proxyCtx;
-        combined.insert(_context.begin(), _context.end());
-        lock.release();
-        s->write(combined);
+        writeCombined(proxyCtx, _context, s);
     }
 }
 
@@ -591,9 +689,7 @@ PerThreadImplicitContext::write(const Context& proxyCtx, ::Ice::OutputStream* s)
     }
     else
     {
-        Context combined = proxyCtx;
-        combined.insert(threadCtx->begin(), threadCtx->end());
-        s->write(combined);
+        writeCombined(proxyCtx, *threadCtx, s);
     }
 }
 
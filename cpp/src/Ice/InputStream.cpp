@@ -24,18 +24,42 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/SlicedData.h>
 #include <Ice/StringConverter.h>
+#include <Ice/ByteSwap.h>
 #include <iterator>
 
-#ifndef ICE_UNALIGNED
-#   if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64)
-#       define ICE_UNALIGNED
-#   endif
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+namespace
+{
+
+//
+// Check whether the given UTF-8 bytes are all ASCII, a word at a time.
+//
+bool
+isASCII(const Byte* p, const Byte* end)
+{
+    for(; end - p >= static_cast<ptrdiff_t>(sizeof(unsigned int)); p += sizeof(unsigned int))
+    {
+        unsigned int w;
+        memcpy(&w, p, sizeof(unsigned int));
+        if(w & 0x80808080U)
+        {
+            return false;
+        }
+    }
+    for(; p != end; ++p)
+    {
+        if(*p & 0x80)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
 
 Ice::InputStream::InputStream()
 {
@@ -563,14 +587,7 @@ Ice::InputStream::read(vector<Short>& v)
         i += sz * static_cast<int>(sizeof(Short));
         v.resize(sz);
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Short) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Short);
-        }
+        byteSwapCopy2(&(*begin), reinterpret_cast<Byte*>(&v[0]), sz);
 #else
         copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
 #endif
@@ -597,6 +614,22 @@ Ice::InputStream::read(pair<const Short*, const Short*>& v, IceUtil::ScopedArray
         i += sz * static_cast<int>(sizeof(Short));
         v.second = reinterpret_cast<Short*>(i);
 #else
+#  ifndef ICE_BIG_ENDIAN
+        //
+        // If the data is suitably aligned, use it in place.
+        //
+        if(reinterpret_cast<size_t>(i) % sizeof(Short) == 0)
+        {
+            v.first = reinterpret_cast<Short*>(i);
+            i += sz * static_cast<int>(sizeof(Short));
+            v.second = reinterpret_cast<Short*>(i);
+#    ifndef ICE_CPP11_MAPPING
+            result.reset();
+#    endif
+            return;
+        }
+#  endif
+
 #  ifdef ICE_CPP11_MAPPING
         auto result = new short[sz];
         _deleters.push_back([result] { delete[] result; });
@@ -611,14 +644,7 @@ Ice::InputStream::read(pair<const Short*, const Short*>& v, IceUtil::ScopedArray
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Short));
 #  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Short) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Short);
-        }
+        byteSwapCopy2(&(*begin), reinterpret_cast<Byte*>(&result[0]), sz);
 #  else
         copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
 #  endif
@@ -643,16 +669,7 @@ Ice::InputStream::read(vector<Int>& v)
         i += sz * static_cast<int>(sizeof(Int));
         v.resize(sz);
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Int) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Int);
-        }
+        byteSwapCopy4(&(*begin), reinterpret_cast<Byte*>(&v[0]), sz);
 #else
         copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
 #endif
@@ -679,6 +696,21 @@ Ice::InputStream::read(pair<const Int*, const Int*>& v, ::IceUtil::ScopedArray<I
         i += sz * static_cast<int>(sizeof(Int));
         v.second = reinterpret_cast<Int*>(i);
 #else
+#  ifndef ICE_BIG_ENDIAN
+        //
+        // If the data is suitably aligned, use it in place.
+        //
+        if(reinterpret_cast<size_t>(i) % sizeof(Int) == 0)
+        {
+            v.first = reinterpret_cast<Int*>(i);
+            i += sz * static_cast<int>(sizeof(Int));
+            v.second = reinterpret_cast<Int*>(i);
+#    ifndef ICE_CPP11_MAPPING
+            result.reset();
+#    endif
+            return;
+        }
+#  endif
 
 #  ifdef ICE_CPP11_MAPPING
         auto result = new int[sz];
@@ -694,16 +726,7 @@ Ice::InputStream::read(pair<const Int*, const Int*>& v, ::IceUtil::ScopedArray<I
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Int));
 #  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Int) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Int);
-        }
+        byteSwapCopy4(&(*begin), reinterpret_cast<Byte*>(&result[0]), sz);
 #  else
         copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
 #  endif
@@ -760,20 +783,7 @@ Ice::InputStream::read(vector<Long>& v)
         i += sz * static_cast<int>(sizeof(Long));
         v.resize(sz);
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Long) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Long);
-        }
+        byteSwapCopy8(&(*begin), reinterpret_cast<Byte*>(&v[0]), sz);
 #else
         copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
 #endif
@@ -800,6 +810,21 @@ Ice::InputStream::read(pair<const Long*, const Long*>& v, IceUtil::ScopedArray<L
         i += sz * static_cast<int>(sizeof(Long));
         v.second = reinterpret_cast<Long*>(i);
 #else
+#  ifndef ICE_BIG_ENDIAN
+        //
+        // If the data is suitably aligned, use it in place.
+        //
+        if(reinterpret_cast<size_t>(i) % sizeof(Long) == 0)
+        {
+            v.first = reinterpret_cast<Long*>(i);
+            i += sz * static_cast<int>(sizeof(Long));
+            v.second = reinterpret_cast<Long*>(i);
+#    ifndef ICE_CPP11_MAPPING
+            result.reset();
+#    endif
+            return;
+        }
+#  endif
 
 #  ifdef ICE_CPP11_MAPPING
         auto result = new long long[sz];
@@ -815,20 +840,7 @@ Ice::InputStream::read(pair<const Long*, const Long*>& v, IceUtil::ScopedArray<L
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Long));
 #  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Long) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Long);
-        }
+        byteSwapCopy8(&(*begin), reinterpret_cast<Byte*>(&result[0]), sz);
 #  else
         copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
 #  endif
@@ -877,16 +889,7 @@ Ice::InputStream::read(vector<Float>& v)
         i += sz * static_cast<int>(sizeof(Float));
         v.resize(sz);
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Float) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Float);
-        }
+        byteSwapCopy4(&(*begin), reinterpret_cast<Byte*>(&v[0]), sz);
 #else
         copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
 #endif
@@ -913,6 +916,21 @@ Ice::InputStream::read(pair<const Float*, const Float*>& v, IceUtil::ScopedArray
         i += sz * static_cast<int>(sizeof(Float));
         v.second = reinterpret_cast<Float*>(i);
 #else
+#  ifndef ICE_BIG_ENDIAN
+        //
+        // If the data is suitably aligned, use it in place.
+        //
+        if(reinterpret_cast<size_t>(i) % sizeof(Float) == 0)
+        {
+            v.first = reinterpret_cast<Float*>(i);
+            i += sz * static_cast<int>(sizeof(Float));
+            v.second = reinterpret_cast<Float*>(i);
+#    ifndef ICE_CPP11_MAPPING
+            result.reset();
+#    endif
+            return;
+        }
+#  endif
 
 #  ifdef ICE_CPP11_MAPPING
         auto result = new float[sz];
@@ -928,16 +946,7 @@ Ice::InputStream::read(pair<const Float*, const Float*>& v, IceUtil::ScopedArray
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Float));
 #  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Float) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Float);
-        }
+        byteSwapCopy4(&(*begin), reinterpret_cast<Byte*>(&result[0]), sz);
 #  else
         copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
 #  endif
@@ -1005,20 +1014,7 @@ Ice::InputStream::read(vector<Double>& v)
         i += sz * static_cast<int>(sizeof(Double));
         v.resize(sz);
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Double) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Double);
-        }
+        byteSwapCopy8(&(*begin), reinterpret_cast<Byte*>(&v[0]), sz);
 #elif defined(ICE_LITTLEBYTE_BIGWORD)
         const Byte* src = &(*begin);
         Byte* dest = reinterpret_cast<Byte*>(&v[0]);
@@ -1061,6 +1057,21 @@ Ice::InputStream::read(pair<const Double*, const Double*>& v, IceUtil::ScopedArr
         i += sz * static_cast<int>(sizeof(Double));
         v.second = reinterpret_cast<Double*>(i);
 #else
+#  if !defined(ICE_BIG_ENDIAN) && !defined(ICE_LITTLEBYTE_BIGWORD)
+        //
+        // If the data is suitably aligned, use it in place.
+        //
+        if(reinterpret_cast<size_t>(i) % sizeof(Double) == 0)
+        {
+            v.first = reinterpret_cast<Double*>(i);
+            i += sz * static_cast<int>(sizeof(Double));
+            v.second = reinterpret_cast<Double*>(i);
+#    ifndef ICE_CPP11_MAPPING
+            result.reset();
+#    endif
+            return;
+        }
+#  endif
 
 #  ifdef ICE_CPP11_MAPPING
         auto result = new double[sz];
@@ -1076,20 +1087,7 @@ Ice::InputStream::read(pair<const Double*, const Double*>& v, IceUtil::ScopedArr
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Double));
 #  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Double) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Double);
-        }
+        byteSwapCopy8(&(*begin), reinterpret_cast<Byte*>(&result[0]), sz);
 #  elif defined(ICE_LITTLEBYTE_BIGWORD)
         const Byte* src = &(*begin);
         Byte* dest = reinterpret_cast<Byte*>(&result[0]);
@@ -1133,7 +1131,7 @@ Ice::InputStream::read(std::string& v, bool convert)
 
         if(!convert || !readConverted(v, sz))
         {
-            string(reinterpret_cast<const char*>(&*i), reinterpret_cast<const char*>(&*i) + sz).swap(v);
+            v.assign(reinterpret_cast<const char*>(&*i), static_cast<size_t>(sz));
         }
         i += sz;
     }
@@ -1269,7 +1267,7 @@ Ice::InputStream::readConverted(string& v, int sz)
         if(_instance)
         {
             const StringConverterPtr& stringConverter = _instance->getStringConverter();
-            if(stringConverter)
+            if(stringConverter && !(_instance->skipASCIIConversion() && isASCII(i, i + sz)))
             {
                 stringConverter->fromUTF8(i, i + sz, v);
                 converted = true;
@@ -1754,25 +1752,23 @@ Ice::InputStream::EncapsDecoder::~EncapsDecoder()
     // Out of line to avoid weak vtable
 }
 
-string
+const string&
 Ice::InputStream::EncapsDecoder::readTypeId(bool isIndex)
 {
     if(isIndex)
     {
         Int index = _stream->readSize();
-        TypeIdMap::const_iterator k = _typeIdMap.find(index);
-        if(k == _typeIdMap.end())
+        if(index < 1 || static_cast<size_t>(index) > _typeIdList.size())
         {
             throw UnmarshalOutOfBoundsException(__FILE__, __LINE__);
         }
-        return k->second;
+        return _typeIdList[index - 1];
     }
     else
     {
-        string typeId;
-        _stream->read(typeId, false);
-        _typeIdMap.insert(make_pair(++_typeIdIndex, typeId));
-        return typeId;
+        _typeIdList.push_back(string());
+        _stream->read(_typeIdList.back(), false);
+        return _typeIdList.back();
     }
 }
 
@@ -1782,41 +1778,50 @@ Ice::InputStream::EncapsDecoder::newInstance(const string& typeId)
     Ice::ValuePtr v;
 
     //
-    // Try to find a factory registered for the specific type.
+    // Resolve the factories for this type ID only once per
+    // encapsulation, graphs usually contain many instances of the
+    // same types.
     //
-#ifdef ICE_CPP11_MAPPING
-    function<ValuePtr(const string&)> userFactory;
-    if(_valueFactoryManager)
+    ValueFactoryCache::iterator p = _valueFactoryCache.find(typeId);
+    if(p == _valueFactoryCache.end())
     {
-        userFactory = _valueFactoryManager->find(typeId);
-        if(userFactory)
+        ValueFactories factories;
+        if(_valueFactoryManager)
         {
-            v = userFactory(typeId);
+            factories.userFactory = _valueFactoryManager->find(typeId);
         }
+        factories.staticFactory = IceInternal::factoryTable->getValueFactory(typeId);
+        p = _valueFactoryCache.insert(make_pair(typeId, factories)).first;
     }
-#else
-    ValueFactoryPtr userFactory;
-    if(_valueFactoryManager)
+
+    //
+    // Try to find a factory registered for the specific type.
+    //
+    if(p->second.userFactory)
     {
-        userFactory = _valueFactoryManager->find(typeId);
-        if(userFactory)
-        {
-            v = userFactory->create(typeId);
-        }
-    }
+#ifdef ICE_CPP11_MAPPING
+        v = p->second.userFactory(typeId);
+#else
+        v = p->second.userFactory->create(typeId);
 #endif
+    }
+
     //
     // If that fails, invoke the default factory if one has been registered.
     //
     if(!v && _valueFactoryManager)
     {
-        userFactory = _valueFactoryManager->find("");
-        if(userFactory)
+        if(!_defaultFactoryResolved)
+        {
+            _defaultFactory = _valueFactoryManager->find("");
+            _defaultFactoryResolved = true;
+        }
+        if(_defaultFactory)
         {
 #ifdef ICE_CPP11_MAPPING
-            v = userFactory(typeId);
+            v = _defaultFactory(typeId);
 #else
-            v = userFactory->create(typeId);
+            v = _defaultFactory->create(typeId);
 #endif
         }
     }
@@ -1825,23 +1830,14 @@ Ice::InputStream::EncapsDecoder::newInstance(const string& typeId)
     // Last chance: check the table of static factories (i.e.,
     // automatically generated factories for concrete classes).
     //
-    if(!v)
+    if(!v && p->second.staticFactory)
     {
 #ifdef ICE_CPP11_MAPPING
-        function<ValuePtr(const string&)> of = IceInternal::factoryTable->getValueFactory(typeId);
-        if(of)
-        {
-            v = of(typeId);
-            assert(v);
-        }
+        v = p->second.staticFactory(typeId);
 #else
-        ValueFactoryPtr of = IceInternal::factoryTable->getValueFactory(typeId);
-        if(of)
-        {
-            v = of->create(typeId);
-            assert(v);
-        }
+        v = p->second.staticFactory->create(typeId);
 #endif
+        assert(v);
     }
     return v;
 }
@@ -1855,10 +1851,9 @@ Ice::InputStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patchFunc, v
     // Check if we already unmarshaled the object. If that's the case,
     // just patch the object smart pointer and we're done.
     //
-    IndexToPtrMap::iterator p = _unmarshaledMap.find(index);
-    if(p != _unmarshaledMap.end())
+    if(static_cast<size_t>(index) <= _unmarshaledList.size() && _unmarshaledList[index - 1])
     {
-        (*patchFunc)(patchAddr, p->second);
+        (*patchFunc)(patchAddr, _unmarshaledList[index - 1]);
         return;
     }
 
@@ -1891,10 +1886,26 @@ void
 Ice::InputStream::EncapsDecoder::unmarshal(Int index, const Ice::ValuePtr& v)
 {
     //
-    // Add the object to the map of unmarshaled instances, this must
+    // Add the object to the list of unmarshaled instances, this must
     // be done before reading the instances (for circular references).
     //
-    _unmarshaledMap.insert(make_pair(index, v));
+    assert(index > 0);
+    if(static_cast<size_t>(index) > _unmarshaledList.size())
+    {
+        //
+        // Each instance takes at least one byte in the stream, larger
+        // indexes can only come from a corrupt or malicious peer.
+        //
+        if(static_cast<size_t>(index) > _stream->b.size())
+        {
+            throw MarshalException(__FILE__, __LINE__, "invalid object id");
+        }
+        _unmarshaledList.resize(index);
+    }
+    if(!_unmarshaledList[index - 1])
+    {
+        _unmarshaledList[index - 1] = v;
+    }
 
     //
     // Read the object.
@@ -857,22 +857,11 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
 
     Reference* ref = _proxy->__reference().get();
 
-    _os.write(ref->getIdentity());
-
     //
-    // For compatibility with the old FacetPath.
+    // Identity, facet and operation name, the reference caches their
+    // encoding.
     //
-    if(ref->getFacet().empty())
-    {
-        _os.write(static_cast<string*>(0), static_cast<string*>(0));
-    }
-    else
-    {
-        string facet = ref->getFacet();
-        _os.write(&facet, &facet + 1);
-    }
-
-    _os.write(operation, false);
+    ref->streamWriteRequestHeader(operation, &_os);
 
     _os.write(static_cast<Byte>(_mode));
 
@@ -21,6 +21,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/SlicedData.h>
 #include <Ice/StringConverter.h>
+#include <Ice/ByteSwap.h>
 #include <iterator>
 
 using namespace std;
@@ -30,6 +31,32 @@ using namespace IceInternal;
 namespace
 {
 
+//
+// Check whether the given native string characters are all ASCII, a
+// word at a time.
+//
+bool
+isASCII(const char* p, const char* end)
+{
+    for(; end - p >= static_cast<ptrdiff_t>(sizeof(unsigned int)); p += sizeof(unsigned int))
+    {
+        unsigned int w;
+        memcpy(&w, p, sizeof(unsigned int));
+        if(w & 0x80808080U)
+        {
+            return false;
+        }
+    }
+    for(; p != end; ++p)
+    {
+        if(*p & 0x80)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 class StreamUTF8BufferI : public IceUtil::UTF8Buffer
 {
 public:
@@ -345,14 +372,7 @@ Ice::OutputStream::write(const Short* begin, const Short* end)
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Short));
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Short) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Short);
-        }
+        byteSwapCopy2(reinterpret_cast<const Byte*>(begin), &b[pos], sz);
 #else
         memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Short));
 #endif
@@ -369,16 +389,7 @@ Ice::OutputStream::write(const Int* begin, const Int* end)
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Int));
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Int) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Int);
-        }
+        byteSwapCopy4(reinterpret_cast<const Byte*>(begin), &b[pos], sz);
 #else
         memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Int));
 #endif
@@ -424,20 +435,7 @@ Ice::OutputStream::write(const Long* begin, const Long* end)
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Long));
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Long) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Long);
-        }
+        byteSwapCopy8(reinterpret_cast<const Byte*>(begin), &b[pos], sz);
 #else
         memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Long));
 #endif
@@ -475,16 +473,7 @@ Ice::OutputStream::write(const Float* begin, const Float* end)
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Float));
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Float) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Float);
-        }
+        byteSwapCopy4(reinterpret_cast<const Byte*>(begin), &b[pos], sz);
 #else
         memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Float));
 #endif
@@ -541,20 +530,7 @@ Ice::OutputStream::write(const Double* begin, const Double* end)
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Double));
 #ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Double) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Double);
-        }
+        byteSwapCopy8(reinterpret_cast<const Byte*>(begin), &b[pos], sz);
 #elif defined(ICE_LITTLEBYTE_BIGWORD)
         const Byte* src = reinterpret_cast<const Byte*>(begin);
         Byte* dest = &(*(b.begin() + pos));
@@ -611,7 +587,7 @@ Ice::OutputStream::writeConverted(const char* vdata, size_t vsize)
         if(_instance)
         {
             const StringConverterPtr& stringConverter = _instance->getStringConverter();
-            if(stringConverter)
+            if(stringConverter && !(_instance->skipASCIIConversion() && isASCII(vdata, vdata + vsize)))
             {
                 lastByte = stringConverter->toUTF8(vdata, vdata + vsize, buffer);
                 converted = true;
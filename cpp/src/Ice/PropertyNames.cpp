@@ -83,6 +83,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Host", false, 0),
@@ -147,6 +148,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.SOCKSProxyPort", false, 0),
     IceInternal::Property("Ice.StdErr", false, 0),
     IceInternal::Property("Ice.StdOut", false, 0),
+    IceInternal::Property("Ice.StringConverter.SkipASCII", false, 0),
     IceInternal::Property("Ice.SyslogFacility", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.SizeMax", false, 0),
@@ -1046,6 +1048,7 @@ const IceInternal::Property IceStormAdminPropsData[] =
     IceInternal::Property("IceStormAdmin.TopicManager.*", false, 0),
     IceInternal::Property("IceStormAdmin.Host", false, 0),
     IceInternal::Property("IceStormAdmin.Port", false, 0),
+    IceInternal::Property("IceStormAdmin.MetricsAdmin", false, 0),
 };
 
 const IceInternal::PropertyArray
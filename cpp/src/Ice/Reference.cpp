@@ -122,6 +122,7 @@ IceInternal::Reference::changeIdentity(const Identity& newIdentity) const
     }
     ReferencePtr r = _instance->referenceFactory()->copy(this);
     r->_identity = newIdentity;
+    r->initRequestHeader();
     return r;
 }
 
@@ -134,6 +135,7 @@ IceInternal::Reference::changeFacet(const string& newFacet) const
     }
     ReferencePtr r = _instance->referenceFactory()->copy(this);
     r->_facet = newFacet;
+    r->initRequestHeader();
     return r;
 }
 
@@ -219,6 +221,58 @@ IceInternal::Reference::streamWrite(OutputStream* s) const
     // Derived class writes the remainder of the reference.
 }
 
+void
+IceInternal::Reference::streamWriteRequestHeader(const string& operation, OutputStream* s) const
+{
+    if(_instance->getStringConverter())
+    {
+        //
+        // The identity and facet must go through the string converter,
+        // the encoded request header can't be used.
+        //
+        s->write(_identity);
+
+        //
+        // For compatibility with the old FacetPath.
+        //
+        if(_facet.empty())
+        {
+            s->write(static_cast<string*>(0), static_cast<string*>(0));
+        }
+        else
+        {
+            s->write(&_facet, &_facet + 1);
+        }
+    }
+    else
+    {
+        s->writeBlob(_requestHeader);
+    }
+    s->write(operation, false);
+}
+
+void
+IceInternal::Reference::initRequestHeader()
+{
+    //
+    // Encode the identity and facet without string conversion, the
+    // reference is immutable once created so this is done only once.
+    //
+    OutputStream os;
+    os.write(_identity.name, false);
+    os.write(_identity.category, false);
+    if(_facet.empty())
+    {
+        os.writeSize(0);
+    }
+    else
+    {
+        os.writeSize(1);
+        os.write(_facet, false);
+    }
+    _requestHeader.assign(os.b.begin(), os.b.end());
+}
+
 string
 IceInternal::Reference::toString() const
 {
@@ -534,6 +588,7 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
     _overrideCompress(false),
     _compress(false)
 {
+    initRequestHeader();
 }
 
 IceInternal::Reference::Reference(const Reference& r) :
@@ -548,6 +603,7 @@ IceInternal::Reference::Reference(const Reference& r) :
     _protocol(r._protocol),
     _encoding(r._encoding),
     _invocationTimeout(r._invocationTimeout),
+    _requestHeader(r._requestHeader),
     _overrideCompress(r._overrideCompress),
     _compress(r._compress)
 {
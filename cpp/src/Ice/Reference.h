@@ -127,6 +127,13 @@ public:
     //
     virtual void streamWrite(Ice::OutputStream*) const;
 
+    //
+    // Marshal the identity, facet and operation name of a request
+    // header. The identity and facet are encoded when the reference
+    // is created.
+    //
+    void streamWriteRequestHeader(const std::string&, Ice::OutputStream*) const;
+
     //
     // Convert the reference to its string form.
     //
@@ -161,6 +168,8 @@ protected:
 
 private:
 
+    void initRequestHeader();
+
     const InstancePtr _instance;
     const Ice::CommunicatorPtr _communicator;
 
@@ -173,6 +182,8 @@ private:
     Ice::EncodingVersion _encoding;
     int _invocationTimeout;
 
+    std::vector<Ice::Byte> _requestHeader; // The encoded identity and facet.
+
 protected:
 
     bool _overrideCompress;
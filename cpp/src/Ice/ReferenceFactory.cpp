@@ -32,6 +32,17 @@ using namespace IceInternal;
 
 IceUtil::Shared* IceInternal::upCast(::IceInternal::ReferenceFactory* p) { return p; }
 
+namespace
+{
+
+//
+// The cache of references created from strings is cleared when it
+// reaches this size.
+//
+const size_t referenceCacheMax = 1024;
+
+}
+
 ReferencePtr
 IceInternal::ReferenceFactory::copy(const Reference* r) const
 {
@@ -97,6 +108,44 @@ IceInternal::ReferenceFactory::create(const Identity& ident, const Ice::Connecti
 
 ReferencePtr
 IceInternal::ReferenceFactory::create(const string& str, const string& propertyPrefix)
+{
+    //
+    // References created with a property prefix depend on the current
+    // value of the proxy properties and can't be shared.
+    //
+    if(!propertyPrefix.empty())
+    {
+        return parse(str, propertyPrefix);
+    }
+
+    //
+    // References are immutable, the references created from the same
+    // string are shared.
+    //
+    {
+        IceUtil::Mutex::Lock sync(_referencesMutex);
+        map<string, ReferencePtr>::const_iterator p = _references.find(str);
+        if(p != _references.end())
+        {
+            return p->second;
+        }
+    }
+
+    ReferencePtr ref = parse(str, propertyPrefix);
+    if(ref)
+    {
+        IceUtil::Mutex::Lock sync(_referencesMutex);
+        if(_references.size() >= referenceCacheMax)
+        {
+            _references.clear();
+        }
+        _references.insert(make_pair(str, ref));
+    }
+    return ref;
+}
+
+ReferencePtr
+IceInternal::ReferenceFactory::parse(const string& str, const string& propertyPrefix)
 {
     if(str.empty())
     {
@@ -11,6 +11,7 @@
 #define ICE_REFERENCE_FACTORY_H
 
 #include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
 #include <Ice/ReferenceFactoryF.h>
 #include <Ice/Reference.h> // For Reference::Mode
 #include <Ice/ConnectionIF.h>
@@ -65,6 +66,7 @@ private:
     ReferenceFactory(const InstancePtr&, const ::Ice::CommunicatorPtr&);
     friend class Instance;
 
+    ReferencePtr parse(const ::std::string&, const std::string&);
     void checkForUnknownProperties(const std::string&);
     RoutableReferencePtr create(const ::Ice::Identity&, const ::std::string&, Reference::Mode, bool, 
                                 const Ice::ProtocolVersion&, const Ice::EncodingVersion&,
@@ -74,6 +76,9 @@ private:
     const ::Ice::CommunicatorPtr _communicator;
     ::Ice::RouterPrxPtr _defaultRouter;
     ::Ice::LocatorPrxPtr _defaultLocator;
+
+    IceUtil::Mutex _referencesMutex;
+    std::map<std::string, ReferencePtr> _references;
 };
 
 }
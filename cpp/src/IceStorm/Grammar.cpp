@@ -149,7 +149,8 @@ yyerror(const char* s)
      ICE_STORM_TOPICS = 266,
      ICE_STORM_REPLICA = 267,
      ICE_STORM_SUBSCRIBERS = 268,
-     ICE_STORM_STRING = 269
+     ICE_STORM_SLOWEST = 269,
+     ICE_STORM_STRING = 270
    };
 #endif
 
@@ -167,7 +168,7 @@ typedef int YYSTYPE;
 
 
 /* Line 264 of yacc.c  */
-#line 171 "Grammar.tab.c"
+#line 172 "Grammar.tab.c"
 
 #ifdef short
 # undef short
@@ -380,22 +381,22 @@ union yyalloc
 #endif
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  42
+#define YYFINAL  45
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   65
+#define YYLAST   70
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  16
+#define YYNTOKENS  17
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  6
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  31
+#define YYNRULES  33
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  56
+#define YYNSTATES  60
 
 /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   269
+#define YYMAXUTOK   270
 
 #define YYTRANSLATE(YYX)						\
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -408,7 +409,7 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,    15,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    16,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -429,7 +430,8 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15
 };
 
 #if YYDEBUG
@@ -438,32 +440,33 @@ static const yytype_uint8 yytranslate[] =
 static const yytype_uint8 yyprhs[] =
 {
        0,     0,     3,     5,     6,     9,    11,    14,    17,    21,
-      25,    29,    33,    37,    41,    45,    49,    53,    57,    60,
-      62,    65,    68,    69,    71,    73,    75,    77,    79,    81,
-      83,    85
+      25,    29,    33,    37,    41,    45,    49,    53,    57,    61,
+      64,    66,    69,    72,    73,    75,    77,    79,    81,    83,
+      85,    87,    89,    91
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
 static const yytype_int8 yyrhs[] =
 {
-      17,     0,    -1,    18,    -1,    -1,    18,    19,    -1,    19,
-      -1,     3,    15,    -1,     4,    15,    -1,     6,    20,    15,
-      -1,     5,    20,    15,    -1,     7,    20,    15,    -1,     8,
-      20,    15,    -1,     9,    20,    15,    -1,    10,    20,    15,
-      -1,    11,    20,    15,    -1,    12,    20,    15,    -1,    13,
-      20,    15,    -1,    14,     1,    15,    -1,     1,    15,    -1,
-      15,    -1,    14,    20,    -1,    21,    20,    -1,    -1,     3,
-      -1,     4,    -1,     5,    -1,     6,    -1,     7,    -1,     8,
-      -1,     9,    -1,    10,    -1,    11,    -1
+      18,     0,    -1,    19,    -1,    -1,    19,    20,    -1,    20,
+      -1,     3,    16,    -1,     4,    16,    -1,     6,    21,    16,
+      -1,     5,    21,    16,    -1,     7,    21,    16,    -1,     8,
+      21,    16,    -1,     9,    21,    16,    -1,    10,    21,    16,
+      -1,    11,    21,    16,    -1,    12,    21,    16,    -1,    13,
+      21,    16,    -1,    14,    21,    16,    -1,    15,     1,    16,
+      -1,     1,    16,    -1,    16,    -1,    15,    21,    -1,    22,
+      21,    -1,    -1,     3,    -1,     4,    -1,     5,    -1,     6,
+      -1,     7,    -1,     8,    -1,     9,    -1,    10,    -1,    11,
+      -1,    14,    -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,    67,    67,    71,    78,    81,    89,    93,    97,   101,
-     105,   109,   113,   117,   121,   125,   129,   133,   137,   141,
-     149,   154,   160,   168,   171,   174,   177,   180,   183,   186,
-     189,   192
+       0,    68,    68,    72,    79,    82,    90,    94,    98,   102,
+     106,   110,   114,   118,   122,   126,   130,   134,   138,   142,
+     146,   154,   159,   165,   173,   176,   179,   182,   185,   188,
+     191,   194,   197,   200
 };
 #endif
 
@@ -476,8 +479,8 @@ static const char *const yytname[] =
   "ICE_STORM_CURRENT", "ICE_STORM_CREATE", "ICE_STORM_DESTROY",
   "ICE_STORM_LINK", "ICE_STORM_UNLINK", "ICE_STORM_LINKS",
   "ICE_STORM_TOPICS", "ICE_STORM_REPLICA", "ICE_STORM_SUBSCRIBERS",
-  "ICE_STORM_STRING", "';'", "$accept", "start", "commands", "command",
-  "strings", "keyword", 0
+  "ICE_STORM_SLOWEST", "ICE_STORM_STRING", "';'", "$accept", "start",
+  "commands", "command", "strings", "keyword", 0
 };
 #endif
 
@@ -487,26 +490,26 @@ static const char *const yytname[] =
 static const yytype_uint16 yytoknum[] =
 {
        0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,    59
+     265,   266,   267,   268,   269,   270,    59
 };
 # endif
 
 /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    16,    17,    17,    18,    18,    19,    19,    19,    19,
-      19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
-      20,    20,    20,    21,    21,    21,    21,    21,    21,    21,
-      21,    21
+       0,    17,    18,    18,    19,    19,    20,    20,    20,    20,
+      20,    20,    20,    20,    20,    20,    20,    20,    20,    20,
+      20,    21,    21,    21,    22,    22,    22,    22,    22,    22,
+      22,    22,    22,    22
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
 static const yytype_uint8 yyr2[] =
 {
        0,     2,     1,     0,     2,     1,     2,     2,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     2,     1,
-       2,     2,     0,     1,     1,     1,     1,     1,     1,     1,
-       1,     1
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     2,
+       1,     2,     2,     0,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1
 };
 
 /* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
@@ -514,18 +517,18 @@ static const yytype_uint8 yyr2[] =
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       0,     0,     0,     0,    22,    22,    22,    22,    22,    22,
-      22,    22,    22,     0,    19,     0,     0,     5,    18,     6,
-       7,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-      22,     0,    22,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     1,     4,    20,     9,    21,     8,    10,    11,
-      12,    13,    14,    15,    16,    17
+       0,     0,     0,     0,    23,    23,    23,    23,    23,    23,
+      23,    23,    23,    23,     0,    20,     0,     0,     5,    19,
+       6,     7,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    23,     0,    23,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     1,     4,    21,     9,    22,
+       8,    10,    11,    12,    13,    14,    15,    16,    17,    18
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,    15,    16,    17,    31,    32
+      -1,    16,    17,    18,    33,    34
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
@@ -533,18 +536,18 @@ static const yytype_int8 yydefgoto[] =
 #define YYPACT_NINF -6
 static const yytype_int8 yypact[] =
 {
-       8,     9,    11,    15,    41,    41,    41,    41,    41,    41,
-      41,    41,    41,    52,    -6,    10,    28,    -6,    -6,    -6,
+       9,    10,    12,    16,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    55,    -6,    11,    30,    -6,    -6,
       -6,    -6,    -6,    -6,    -6,    -6,    -6,    -6,    -6,    -6,
-      41,    39,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    -6,    -6,    -6,    -6,    -6,    -6,    -6,    -6,
-      -6,    -6,    -6,    -6,    -6,    -6
+      -6,    -6,    44,    41,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    -6,    -6,    -6,    -6,    -6,
+      -6,    -6,    -6,    -6,    -6,    -6,    -6,    -6,    -6,    -6
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-      -6,    -6,    -6,    40,    -5,    -6
+      -6,    -6,    -6,    43,    -5,    -6
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
@@ -554,24 +557,26 @@ static const yytype_int8 yypgoto[] =
 #define YYTABLE_NINF -4
 static const yytype_int8 yytable[] =
 {
-      33,    34,    35,    36,    37,    38,    39,    40,    -3,     1,
-      42,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    18,    44,    19,    46,    -2,     1,
-      20,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    41,    45,    30,    43,    47,    48,    49,
-      50,    51,    52,    53,    54,    55
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    -3,
+       1,    45,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    19,    47,    20,    49,
+      -2,     1,    21,     2,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    44,    48,    31,    32,
+      46,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59
 };
 
 static const yytype_uint8 yycheck[] =
 {
-       5,     6,     7,     8,     9,    10,    11,    12,     0,     1,
-       0,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    15,    15,    30,    15,    32,     0,     1,
-      15,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    15,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,     1,    15,    14,    16,    15,    15,    15,
-      15,    15,    15,    15,    15,    15
+       5,     6,     7,     8,     9,    10,    11,    12,    13,     0,
+       1,     0,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    16,    32,    16,    34,
+       0,     1,    16,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,     1,    16,    14,    15,
+      17,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+      16
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -579,11 +584,11 @@ static const yytype_uint8 yycheck[] =
 static const yytype_uint8 yystos[] =
 {
        0,     1,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    17,    18,    19,    15,    15,
-      15,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      14,    20,    21,    20,    20,    20,    20,    20,    20,    20,
-      20,     1,     0,    19,    20,    15,    20,    15,    15,    15,
-      15,    15,    15,    15,    15,    15
+      11,    12,    13,    14,    15,    16,    18,    19,    20,    16,
+      16,    16,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    14,    15,    21,    22,    21,    21,    21,    21,    21,
+      21,    21,    21,    21,     1,     0,    20,    21,    16,    21,
+      16,    16,    16,    16,    16,    16,    16,    16,    16,    16
 };
 
 #define yyerrok		(yyerrstatus = 0)
@@ -1396,7 +1401,7 @@ yyreduce:
         case 2:
 
 /* Line 1455 of yacc.c  */
-#line 68 "Grammar.y"
+#line 69 "Grammar.y"
     {
 ;}
     break;
@@ -1404,7 +1409,7 @@ yyreduce:
   case 3:
 
 /* Line 1455 of yacc.c  */
-#line 71 "Grammar.y"
+#line 72 "Grammar.y"
     {
 ;}
     break;
@@ -1412,7 +1417,7 @@ yyreduce:
   case 4:
 
 /* Line 1455 of yacc.c  */
-#line 79 "Grammar.y"
+#line 80 "Grammar.y"
     {
 ;}
     break;
@@ -1420,7 +1425,7 @@ yyreduce:
   case 5:
 
 /* Line 1455 of yacc.c  */
-#line 82 "Grammar.y"
+#line 83 "Grammar.y"
     {
 ;}
     break;
@@ -1428,7 +1433,7 @@ yyreduce:
   case 6:
 
 /* Line 1455 of yacc.c  */
-#line 90 "Grammar.y"
+#line 91 "Grammar.y"
     {
     parser->usage();
 ;}
@@ -1437,7 +1442,7 @@ yyreduce:
   case 7:
 
 /* Line 1455 of yacc.c  */
-#line 94 "Grammar.y"
+#line 95 "Grammar.y"
     {
     return 0;
 ;}
@@ -1446,7 +1451,7 @@ yyreduce:
   case 8:
 
 /* Line 1455 of yacc.c  */
-#line 98 "Grammar.y"
+#line 99 "Grammar.y"
     {
     parser->create((yyvsp[(2) - (3)]));
 ;}
@@ -1455,7 +1460,7 @@ yyreduce:
   case 9:
 
 /* Line 1455 of yacc.c  */
-#line 102 "Grammar.y"
+#line 103 "Grammar.y"
     {
     parser->current((yyvsp[(2) - (3)]));
 ;}
@@ -1464,7 +1469,7 @@ yyreduce:
   case 10:
 
 /* Line 1455 of yacc.c  */
-#line 106 "Grammar.y"
+#line 107 "Grammar.y"
     {
     parser->destroy((yyvsp[(2) - (3)]));
 ;}
@@ -1473,7 +1478,7 @@ yyreduce:
   case 11:
 
 /* Line 1455 of yacc.c  */
-#line 110 "Grammar.y"
+#line 111 "Grammar.y"
     {
     parser->link((yyvsp[(2) - (3)]));
 ;}
@@ -1482,7 +1487,7 @@ yyreduce:
   case 12:
 
 /* Line 1455 of yacc.c  */
-#line 114 "Grammar.y"
+#line 115 "Grammar.y"
     {
     parser->unlink((yyvsp[(2) - (3)]));
 ;}
@@ -1491,7 +1496,7 @@ yyreduce:
   case 13:
 
 /* Line 1455 of yacc.c  */
-#line 118 "Grammar.y"
+#line 119 "Grammar.y"
     {
     parser->links((yyvsp[(2) - (3)]));
 ;}
@@ -1500,7 +1505,7 @@ yyreduce:
   case 14:
 
 /* Line 1455 of yacc.c  */
-#line 122 "Grammar.y"
+#line 123 "Grammar.y"
     {
     parser->topics((yyvsp[(2) - (3)]));
 ;}
@@ -1509,7 +1514,7 @@ yyreduce:
   case 15:
 
 /* Line 1455 of yacc.c  */
-#line 126 "Grammar.y"
+#line 127 "Grammar.y"
     {
     parser->replica((yyvsp[(2) - (3)]));
 ;}
@@ -1518,7 +1523,7 @@ yyreduce:
   case 16:
 
 /* Line 1455 of yacc.c  */
-#line 130 "Grammar.y"
+#line 131 "Grammar.y"
     {
     parser->subscribers((yyvsp[(2) - (3)]));
 ;}
@@ -1527,36 +1532,35 @@ yyreduce:
   case 17:
 
 /* Line 1455 of yacc.c  */
-#line 134 "Grammar.y"
+#line 135 "Grammar.y"
     {
-    parser->invalidCommand("unknown command `" + (yyvsp[(1) - (3)]).front() + "' (type `help' for more info)");
+    parser->slowest((yyvsp[(2) - (3)]));
 ;}
     break;
 
   case 18:
 
 /* Line 1455 of yacc.c  */
-#line 138 "Grammar.y"
+#line 139 "Grammar.y"
     {
-    yyerrok;
+    parser->invalidCommand("unknown command `" + (yyvsp[(1) - (3)]).front() + "' (type `help' for more info)");
 ;}
     break;
 
   case 19:
 
 /* Line 1455 of yacc.c  */
-#line 142 "Grammar.y"
+#line 143 "Grammar.y"
     {
+    yyerrok;
 ;}
     break;
 
   case 20:
 
 /* Line 1455 of yacc.c  */
-#line 150 "Grammar.y"
+#line 147 "Grammar.y"
     {
-    (yyval) = (yyvsp[(2) - (2)]);
-    (yyval).push_front((yyvsp[(1) - (2)]).front());
 ;}
     break;
 
@@ -1575,22 +1579,24 @@ yyreduce:
 /* Line 1455 of yacc.c  */
 #line 160 "Grammar.y"
     {
-    (yyval) = YYSTYPE();
+    (yyval) = (yyvsp[(2) - (2)]);
+    (yyval).push_front((yyvsp[(1) - (2)]).front());
 ;}
     break;
 
   case 23:
 
 /* Line 1455 of yacc.c  */
-#line 169 "Grammar.y"
+#line 165 "Grammar.y"
     {
+    (yyval) = YYSTYPE();
 ;}
     break;
 
   case 24:
 
 /* Line 1455 of yacc.c  */
-#line 172 "Grammar.y"
+#line 174 "Grammar.y"
     {
 ;}
     break;
@@ -1598,7 +1604,7 @@ yyreduce:
   case 25:
 
 /* Line 1455 of yacc.c  */
-#line 175 "Grammar.y"
+#line 177 "Grammar.y"
     {
 ;}
     break;
@@ -1606,7 +1612,7 @@ yyreduce:
   case 26:
 
 /* Line 1455 of yacc.c  */
-#line 178 "Grammar.y"
+#line 180 "Grammar.y"
     {
 ;}
     break;
@@ -1614,7 +1620,7 @@ yyreduce:
   case 27:
 
 /* Line 1455 of yacc.c  */
-#line 181 "Grammar.y"
+#line 183 "Grammar.y"
     {
 ;}
     break;
@@ -1622,7 +1628,7 @@ yyreduce:
   case 28:
 
 /* Line 1455 of yacc.c  */
-#line 184 "Grammar.y"
+#line 186 "Grammar.y"
     {
 ;}
     break;
@@ -1630,7 +1636,7 @@ yyreduce:
   case 29:
 
 /* Line 1455 of yacc.c  */
-#line 187 "Grammar.y"
+#line 189 "Grammar.y"
     {
 ;}
     break;
@@ -1638,7 +1644,7 @@ yyreduce:
   case 30:
 
 /* Line 1455 of yacc.c  */
-#line 190 "Grammar.y"
+#line 192 "Grammar.y"
     {
 ;}
     break;
@@ -1646,7 +1652,23 @@ yyreduce:
   case 31:
 
 /* Line 1455 of yacc.c  */
-#line 193 "Grammar.y"
+#line 195 "Grammar.y"
+    {
+;}
+    break;
+
+  case 32:
+
+/* Line 1455 of yacc.c  */
+#line 198 "Grammar.y"
+    {
+;}
+    break;
+
+  case 33:
+
+/* Line 1455 of yacc.c  */
+#line 201 "Grammar.y"
     {
 ;}
     break;
@@ -1654,7 +1676,7 @@ yyreduce:
 
 
 /* Line 1455 of yacc.c  */
-#line 1658 "Grammar.tab.c"
+#line 1680 "Grammar.tab.c"
       default: break;
     }
   YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
@@ -1866,6 +1888,6 @@ yyreturn:
 
 
 /* Line 1675 of yacc.c  */
-#line 196 "Grammar.y"
+#line 204 "Grammar.y"
 
 
@@ -50,7 +50,8 @@
      ICE_STORM_TOPICS = 266,
      ICE_STORM_REPLICA = 267,
      ICE_STORM_SUBSCRIBERS = 268,
-     ICE_STORM_STRING = 269
+     ICE_STORM_SLOWEST = 269,
+     ICE_STORM_STRING = 270
    };
 #endif
 
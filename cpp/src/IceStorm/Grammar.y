@@ -57,6 +57,7 @@ yyerror(const char* s)
 %token ICE_STORM_TOPICS
 %token ICE_STORM_REPLICA
 %token ICE_STORM_SUBSCRIBERS
+%token ICE_STORM_SLOWEST
 %token ICE_STORM_STRING
 
 %%
@@ -130,6 +131,10 @@ command
 {
     parser->subscribers($2);
 }
+| ICE_STORM_SLOWEST strings ';'
+{
+    parser->slowest($2);
+}
 | ICE_STORM_STRING error ';'
 {
     parser->invalidCommand("unknown command `" + $1.front() + "' (type `help' for more info)");
@@ -192,5 +197,8 @@ keyword
 | ICE_STORM_TOPICS
 {
 }
+| ICE_STORM_SLOWEST
+{
+}
 
 %%
@@ -113,6 +113,10 @@ Instance::Instance(
     _sendTimeout(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.Timeout", 60 * 1000)),
     _sendQueueSizeMax(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.QueueSizeMax", -1)),
     _sendQueueSizeMaxPolicy(RemoveSubscriber),
+    // default no event retained for replay.
+    _replaySizeMax(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Replay.SizeMax", 0)),
+    _replayTimeout(IceUtil::Time::seconds(communicator->getProperties()->getPropertyAsIntWithDefault(
+                                              name + ".Replay.Timeout", 0))), // default no time limit.
     _topicReaper(new TopicReaper())
 {
     try
@@ -317,6 +321,18 @@ Instance::sendQueueSizeMaxPolicy() const
     return _sendQueueSizeMaxPolicy;
 }
 
+int
+Instance::replaySizeMax() const
+{
+    return _replaySizeMax;
+}
+
+IceUtil::Time
+Instance::replayTimeout() const
+{
+    return _replayTimeout;
+}
+
 void
 Instance::shutdown()
 {
@@ -96,6 +96,8 @@ public:
     int sendTimeout() const;
     int sendQueueSizeMax() const;
     SendQueueSizeMaxPolicy sendQueueSizeMaxPolicy() const;
+    int replaySizeMax() const;
+    IceUtil::Time replayTimeout() const;
 
     void shutdown();
     virtual void destroy();
@@ -115,6 +117,8 @@ private:
     const int _sendTimeout;
     const int _sendQueueSizeMax;
     const SendQueueSizeMaxPolicy _sendQueueSizeMaxPolicy;
+    const int _replaySizeMax;
+    const IceUtil::Time _replayTimeout;
     const Ice::ObjectPrx _topicReplicaProxy;
     const Ice::ObjectPrx _publisherReplicaProxy;
     const TopicReaperPtr _topicReaper;
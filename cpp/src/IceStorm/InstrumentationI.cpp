@@ -248,6 +248,10 @@ struct QueuedUpdate
     void operator()(const SubscriberMetricsPtr& v)
     {
         v->queued += count;
+        if(v->queued > *v->queuedMax)
+        {
+            v->queuedMax = v->queued;
+        }
     }
 
     int count;
@@ -294,7 +298,7 @@ namespace
 
 struct DeliveredUpdate
 {
-    DeliveredUpdate(int count) : count(count)
+    DeliveredUpdate(int count, Ice::Long time, Ice::Long timeMax) : count(count), time(time), timeMax(timeMax)
     {
     }
 
@@ -305,17 +309,24 @@ struct DeliveredUpdate
             v->outstanding -= count;
         }
         v->delivered += count;
+        *v->deliveryTime += time;
+        if(timeMax > *v->deliveryTimeMax)
+        {
+            v->deliveryTimeMax = timeMax;
+        }
     }
 
     int count;
+    Ice::Long time;
+    Ice::Long timeMax;
 };
 
 }
 
 void
-SubscriberObserverI::delivered(int count)
+SubscriberObserverI::delivered(int count, Ice::Long time, Ice::Long timeMax)
 {
-    forEach(DeliveredUpdate(count));
+    forEach(DeliveredUpdate(count, time, timeMax));
 }
 
 TopicManagerObserverI::TopicManagerObserverI(const IceInternal::MetricsAdminIPtr& metrics) : 
@@ -34,7 +34,7 @@ public:
 
     virtual void queued(int);
     virtual void outstanding(int);
-    virtual void delivered(int);
+    virtual void delivered(int, Ice::Long, Ice::Long);
 };
 
 class TopicManagerObserverI : public IceStorm::Instrumentation::TopicManagerObserver
@@ -11,6 +11,7 @@
 #include <Ice/Ice.h>
 #include <IceStorm/Parser.h>
 #include <IceStorm/IceStormInternal.h>
+#include <IceStorm/Metrics.h>
 #include <algorithm>
 
 #ifdef HAVE_READLINE
@@ -104,6 +105,9 @@ Parser::usage()
         "                         INSTANCE-NAME.\n"
         "replica [INSTANCE-NAME]  Display replication information for the given INSTANCE-NAME.\n"
         "subscribers TOPICS       List TOPICS subscribers.\n"
+        "slowest VIEW [COUNT]     List the COUNT (default 10) subscribers with the highest\n"
+        "                         average delivery latency in the metrics VIEW of the\n"
+        "                         IceStormAdmin.MetricsAdmin facet.\n"
         ;
 }
 
@@ -378,6 +382,111 @@ Parser::subscribers(const list<string>& args)
     }
 }
 
+namespace
+{
+
+struct SlowerSubscriber
+{
+    static double
+    latency(const IceMX::SubscriberMetricsPtr& m)
+    {
+        //
+        // The delivery time is optional, it's not set by IceStorm services
+        // which don't record the delivery latency.
+        //
+        return m->delivered > 0 && m->deliveryTime ? static_cast<double>(*m->deliveryTime) / m->delivered : 0.0;
+    }
+
+    bool
+    operator()(const IceMX::SubscriberMetricsPtr& lhs, const IceMX::SubscriberMetricsPtr& rhs) const
+    {
+        return latency(lhs) > latency(rhs);
+    }
+};
+
+}
+
+void
+Parser::slowest(const list<string>& args)
+{
+    if(args.empty() || args.size() > 2)
+    {
+        error("`slowest' requires one or two arguments (type `help' for more info)");
+        return;
+    }
+
+    string proxy = _communicator->getProperties()->getProperty("IceStormAdmin.MetricsAdmin");
+    if(proxy.empty())
+    {
+        error("`slowest' requires the IceStormAdmin.MetricsAdmin property to be set");
+        return;
+    }
+
+    try
+    {
+        list<string>::const_iterator p = args.begin();
+        string view = *p++;
+        size_t count = p != args.end() ? static_cast<size_t>(max(atoi(p->c_str()), 0)) : 10;
+
+        IceMX::MetricsAdminPrx admin = IceMX::MetricsAdminPrx::checkedCast(_communicator->stringToProxy(proxy));
+        if(!admin)
+        {
+            error("`" + proxy + "' is not a metrics admin facet");
+            return;
+        }
+
+        Ice::Long timestamp;
+        IceMX::MetricsView metrics = admin->getMetricsView(view, timestamp);
+        IceMX::MetricsView::const_iterator q = metrics.find("Subscriber");
+        if(q == metrics.end())
+        {
+            error("metrics view `" + view + "' doesn't have subscriber metrics");
+            return;
+        }
+
+        vector<IceMX::SubscriberMetricsPtr> subscribers;
+        for(IceMX::MetricsMap::const_iterator r = q->second.begin(); r != q->second.end(); ++r)
+        {
+            IceMX::SubscriberMetricsPtr m = IceMX::SubscriberMetricsPtr::dynamicCast(*r);
+            if(m)
+            {
+                subscribers.push_back(m);
+            }
+        }
+        sort(subscribers.begin(), subscribers.end(), SlowerSubscriber());
+        if(subscribers.size() > count)
+        {
+            subscribers.resize(count);
+        }
+
+        for(vector<IceMX::SubscriberMetricsPtr>::const_iterator r = subscribers.begin(); r != subscribers.end(); ++r)
+        {
+            cout << (*r)->id << ":" << endl;
+            if((*r)->deliveryTime && (*r)->deliveryTimeMax)
+            {
+                cout << "\taverage latency: " << SlowerSubscriber::latency(*r) / 1000.0 << "ms" << endl;
+                cout << "\tmax latency:     " << *(*r)->deliveryTimeMax / 1000.0 << "ms" << endl;
+            }
+            else
+            {
+                cout << "\tlatency:         unknown" << endl;
+            }
+            cout << "\tdelivered:       " << (*r)->delivered << endl;
+            cout << "\tqueued:          " << (*r)->queued;
+            if((*r)->queuedMax)
+            {
+                cout << " (max " << *(*r)->queuedMax << ")";
+            }
+            cout << endl;
+            cout << "\toutstanding:     " << (*r)->outstanding << endl;
+        }
+    }
+    catch(const Exception& ex)
+    {
+        exception(ex);
+    }
+}
+
 void
 Parser::current(const list<string>& args)
 {
@@ -709,6 +818,10 @@ Parser::exception(const Ice::Exception& ex, bool warn)
     {
         os << "invalid identity `" << ex.str << "'";
     }
+    catch(const IceMX::UnknownMetricsView&)
+    {
+        os << "couldn't find metrics view";
+    }
     catch(const Ice::LocalException& ex)
     {
         os << "couldn't reach IceStorm service:\n" << ex;
@@ -66,6 +66,7 @@ public:
     void topics(const std::list<std::string>&);
     void replica(const std::list<std::string>&);
     void subscribers(const std::list<std::string>&);
+    void slowest(const std::list<std::string>&);
     void current(const std::list<std::string>&);
 
     void showBanner();
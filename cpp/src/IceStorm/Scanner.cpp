@@ -2012,6 +2012,7 @@ initScanner()
     keywordMap["topics"] = ICE_STORM_TOPICS;
     keywordMap["replica"] = ICE_STORM_REPLICA;
     keywordMap["subscribers"] = ICE_STORM_SUBSCRIBERS;
+    keywordMap["slowest"] = ICE_STORM_SLOWEST;
 }
 
 }
@@ -537,6 +537,8 @@ ServiceI::validateProperties(const string& name, const PropertiesPtr& properties
         "Send.Timeout",
         "Send.QueueSizeMax",
         "Send.QueueSizeMaxPolicy",
+        "Replay.SizeMax",
+        "Replay.Timeout",
         "Discard.Interval",
         "LMDB.Path",
         "LMDB.MapSize"
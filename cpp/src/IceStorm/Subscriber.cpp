@@ -13,6 +13,7 @@
 #include <IceStorm/NodeI.h>
 #include <IceStorm/Util.h>
 #include <Ice/LoggerUtil.h>
+#include <IceUtil/StringUtil.h>
 #include <iterator>
 
 using namespace std;
@@ -96,6 +97,51 @@ toSubscriberState(Subscriber::SubscriberState s)
     }
 }
 
+//
+// The "filter.operation" QoS lists the operations sent to the
+// subscriber, separated by commas or white space.
+//
+set<string>
+toFilterOperations(const QoS& qos)
+{
+    set<string> operations;
+    QoS::const_iterator p = qos.find("filter.operation");
+    if(p != qos.end())
+    {
+        vector<string> names;
+        if(!IceUtilInternal::splitString(p->second, ", \t", names) || names.empty())
+        {
+            throw BadQoS("invalid filter.operation: " + p->second);
+        }
+        operations.insert(names.begin(), names.end());
+    }
+    return operations;
+}
+
+//
+// Each "filter.context.<key>" QoS requires the events sent to the
+// subscriber to carry the <key> context entry with the QoS value.
+//
+Ice::Context
+toFilterContext(const QoS& qos)
+{
+    const string prefix = "filter.context.";
+    Ice::Context ctx;
+    for(QoS::const_iterator p = qos.lower_bound(prefix);
+        p != qos.end() && p->first.compare(0, prefix.size(), prefix) == 0; ++p)
+    {
+        ctx[p->first.substr(prefix.size())] = p->second;
+    }
+    return ctx;
+}
+
+string
+toConflationKey(const QoS& qos)
+{
+    QoS::const_iterator p = qos.find("conflate");
+    return p == qos.end() ? string() : p->second;
+}
+
 }
 
 // Each of the various Subscriber types.
@@ -111,13 +157,13 @@ public:
 
     virtual void flush();
 
-    void exception(const Ice::Exception& ex)
+    void exception(const Ice::Exception& ex, const OutstandingEventsPtr&)
     {
         error(false, ex);
     }
 
     void doFlush();
-    void sent(bool);
+    void sent(bool, const OutstandingEventsPtr&);
 
 private:
 
@@ -130,20 +176,22 @@ class SubscriberOneway : public Subscriber
 {
 public:
 
-    SubscriberOneway(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, const Ice::ObjectPrx&);
+    SubscriberOneway(const InstancePtr&, const SubscriberRecord&, const Ice::ObjectPrx&, int, const Ice::ObjectPrx&,
+                     bool);
     ~SubscriberOneway();
 
     virtual void flush();
 
-    void exception(const Ice::Exception& ex)
+    void exception(const Ice::Exception& ex, const OutstandingEventsPtr&)
     {
         error(true, ex);
     }
-    void sent(bool);
+    void sent(bool, const OutstandingEventsPtr&);
 
 private:
 
     const Ice::ObjectPrx _obj;
+    const Ice::ObjectPrx _batchObj; // Only set for burst delivery.
 };
 typedef IceUtil::Handle<SubscriberOneway> SubscriberOnewayPtr;
 
@@ -236,14 +284,19 @@ SubscriberBatch::doFlush()
         return;
     }
 
+    assert(!_events.empty());
     EventDataSeq v;
-    v.swap(_events);
-    assert(!v.empty());
+    OutstandingEventsPtr outstanding = new OutstandingEvents;
+    while(!_events.empty())
+    {
+        pair<IceUtil::Time, EventDataPtr> e = dequeue();
+        v.push_back(e.second);
+        outstanding->add(e.first);
+    }
 
     if(_observer)
     {
-        _outstandingCount = static_cast<Ice::Int>(v.size());
-        _observer->outstanding(_outstandingCount);
+        _observer->outstanding(outstanding->count);
     }
 
     try
@@ -257,15 +310,13 @@ SubscriberBatch::doFlush()
         Ice::AsyncResultPtr result = _obj->begin_ice_flushBatchRequests(
             Ice::newCallback_Object_ice_flushBatchRequests(this,
                                                            &SubscriberBatch::exception,
-                                                           &SubscriberBatch::sent));
+                                                           &SubscriberBatch::sent),
+            outstanding);
         if(result->sentSynchronously())
         {
             --_outstanding;
             assert(_outstanding == 0);
-            if(_observer)
-            {
-                _observer->delivered(_outstandingCount);
-            }
+            delivered(outstanding);
         }
     }
     catch(const Ice::Exception& ex)
@@ -286,7 +337,7 @@ SubscriberBatch::doFlush()
 }
 
 void
-SubscriberBatch::sent(bool sentSynchronously)
+SubscriberBatch::sent(bool sentSynchronously, const OutstandingEventsPtr& outstanding)
 {
     if(sentSynchronously)
     {
@@ -298,10 +349,7 @@ SubscriberBatch::sent(bool sentSynchronously)
     // Decrement the _outstanding count.
     --_outstanding;
     assert(_outstanding == 0);
-    if(_observer)
-    {
-        _observer->delivered(_outstandingCount);
-    }
+    delivered(outstanding);
 
     if(_events.empty() && _outstanding == 0 && _shutdown)
     {
@@ -319,9 +367,11 @@ SubscriberOneway::SubscriberOneway(
     const SubscriberRecord& rec,
     const Ice::ObjectPrx& proxy,
     int retryCount,
-    const Ice::ObjectPrx& obj) :
+    const Ice::ObjectPrx& obj,
+    bool burst) :
     Subscriber(instance, rec, proxy, retryCount, 5),
-    _obj(obj)
+    _obj(obj),
+    _batchObj(burst ? obj->ice_batchOneway() : Ice::ObjectPrx())
 {
     assert(retryCount == 0);
 }
@@ -346,30 +396,83 @@ SubscriberOneway::flush()
     // Send up to _maxOutstanding pending events.
     while(_outstanding < _maxOutstanding && !_events.empty())
     {
+        if(_batchObj && _events.size() > 1)
+        {
+            //
+            // Burst delivery: send all the queued events as a single
+            // batch, without waiting for a flush timer. The batch
+            // counts as one outstanding request. The events are only
+            // reported as outstanding once the batch is sent or
+            // queued for sending.
+            //
+            EventDataSeq v;
+            OutstandingEventsPtr outstanding = new OutstandingEvents;
+            while(!_events.empty())
+            {
+                pair<IceUtil::Time, EventDataPtr> e = dequeue();
+                v.push_back(e.second);
+                outstanding->add(e.first);
+            }
+
+            try
+            {
+                vector<Ice::Byte> dummy;
+                for(EventDataSeq::const_iterator p = v.begin(); p != v.end(); ++p)
+                {
+                    _batchObj->ice_invoke((*p)->op, (*p)->mode, (*p)->data, dummy, (*p)->context);
+                }
+
+                Ice::AsyncResultPtr result = _batchObj->begin_ice_flushBatchRequests(
+                    Ice::newCallback_Object_ice_flushBatchRequests(this,
+                                                                   &SubscriberOneway::exception,
+                                                                   &SubscriberOneway::sent),
+                    outstanding);
+                if(_observer)
+                {
+                    _observer->outstanding(outstanding->count);
+                }
+                if(!result->sentSynchronously())
+                {
+                    ++_outstanding;
+                }
+                else
+                {
+                    delivered(outstanding);
+                }
+            }
+            catch(const Ice::Exception& ex)
+            {
+                error(true, ex);
+                return;
+            }
+            continue;
+        }
+
         //
         // Dequeue the head event, count one more outstanding AMI
         // request.
         //
-        EventDataPtr e = _events.front();
-        _events.erase(_events.begin());
-        if(_observer)
-        {
-            _observer->outstanding(1);
-        }
+        pair<IceUtil::Time, EventDataPtr> e = dequeue();
+        OutstandingEventsPtr outstanding = new OutstandingEvents;
+        outstanding->add(e.first);
 
         try
         {
             Ice::AsyncResultPtr result = _obj->begin_ice_invoke(
-                e->op, e->mode, e->data, e->context, Ice::newCallback_Object_ice_invoke(this,
-                                                                                        &SubscriberOneway::exception,
-                                                                                        &SubscriberOneway::sent));
+                e.second->op, e.second->mode, e.second->data, e.second->context,
+                Ice::newCallback_Object_ice_invoke(this, &SubscriberOneway::exception, &SubscriberOneway::sent),
+                outstanding);
+            if(_observer)
+            {
+                _observer->outstanding(1);
+            }
             if(!result->sentSynchronously())
             {
                 ++_outstanding;
             }
-            else if(_observer)
+            else
             {
-                _observer->delivered(1);
+                delivered(outstanding);
             }
         }
         catch(const Ice::Exception& ex)
@@ -386,7 +489,7 @@ SubscriberOneway::flush()
 }
 
 void
-SubscriberOneway::sent(bool sentSynchronously)
+SubscriberOneway::sent(bool sentSynchronously, const OutstandingEventsPtr& outstanding)
 {
     if(sentSynchronously)
     {
@@ -398,10 +501,7 @@ SubscriberOneway::sent(bool sentSynchronously)
     // Decrement the _outstanding count.
     --_outstanding;
     assert(_outstanding >= 0 && _outstanding < _maxOutstanding);
-    if(_observer)
-    {
-        _observer->delivered(1);
-    }
+    delivered(outstanding);
 
     if(_events.empty() && _outstanding == 0 && _shutdown)
     {
@@ -445,8 +545,9 @@ SubscriberTwoway::flush()
         // Dequeue the head event, count one more outstanding AMI
         // request.
         //
-        EventDataPtr e = _events.front();
-        _events.erase(_events.begin());
+        pair<IceUtil::Time, EventDataPtr> e = dequeue();
+        OutstandingEventsPtr outstanding = new OutstandingEvents;
+        outstanding->add(e.first);
         ++_outstanding;
         if(_observer)
         {
@@ -455,8 +556,9 @@ SubscriberTwoway::flush()
 
         try
         {
-            _obj->begin_ice_invoke(e->op, e->mode, e->data, e->context,
-                                   Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed));
+            _obj->begin_ice_invoke(e.second->op, e.second->mode, e.second->data, e.second->context,
+                                   Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed),
+                                   outstanding);
         }
         catch(const Ice::Exception& ex)
         {
@@ -488,26 +590,25 @@ SubscriberLink::flush()
     }
 
     EventDataSeq v;
-    v.swap(_events);
-
-    EventDataSeq::iterator p = v.begin();
-    while(p != v.end())
+    OutstandingEventsPtr outstanding = new OutstandingEvents;
+    while(!_events.empty())
     {
+        pair<IceUtil::Time, EventDataPtr> e = dequeue();
         if(_rec.cost != 0)
         {
             int cost = 0;
-            Ice::Context::const_iterator q = (*p)->context.find("cost");
-            if(q != (*p)->context.end())
+            Ice::Context::const_iterator q = e.second->context.find("cost");
+            if(q != e.second->context.end())
             {
                 cost = atoi(q->second.c_str());
             }
             if(cost > _rec.cost)
             {
-                p = v.erase(p);
                 continue;
             }
         }
-        ++p;
+        v.push_back(e.second);
+        outstanding->add(e.first);
     }
 
     if(!v.empty())
@@ -517,10 +618,10 @@ SubscriberLink::flush()
             ++_outstanding;
             if(_observer)
             {
-                _outstandingCount = static_cast<Ice::Int>(v.size());
-                _observer->outstanding(_outstandingCount);
+                _observer->outstanding(outstanding->count);
             }
-            _obj->begin_forward(v, Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed));
+            _obj->begin_forward(v, Ice::newCallback(static_cast<Subscriber*>(this), &Subscriber::completed),
+                                outstanding);
         }
         catch(const Ice::Exception& ex)
         {
@@ -560,6 +661,13 @@ Subscriber::create(
                 retryCount = atoi(p->second.c_str());
             }
 
+            bool burst = false;
+            p = rec.theQoS.find("burst");
+            if(p != rec.theQoS.end())
+            {
+                burst = atoi(p->second.c_str()) > 0;
+            }
+
             string reliability;
             p = rec.theQoS.find("reliability");
             if(p != rec.theQoS.end())
@@ -588,6 +696,11 @@ Subscriber::create(
                 //
                 newObj = rec.obj;
             }
+            if(burst && (!newObj->ice_isOneway() || reliability == "ordered"))
+            {
+                throw BadQoS("burst QoS requires a oneway proxy");
+            }
+
             if(reliability == "ordered")
             {
                 if(!newObj->ice_isTwoway())
@@ -602,7 +715,7 @@ Subscriber::create(
                 {
                     throw BadQoS("non-zero retryCount QoS requires a twoway proxy");
                 }
-                subscriber = new SubscriberOneway(instance, rec, proxy, retryCount, newObj);
+                subscriber = new SubscriberOneway(instance, rec, proxy, retryCount, newObj, burst);
             }
             else if(newObj->ice_isBatchOneway() || newObj->ice_isBatchDatagram())
             {
@@ -655,8 +768,6 @@ Subscriber::record() const
 bool
 Subscriber::queue(bool forwarded, const EventDataSeq& events)
 {
-    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
-
     // If this is a link subscriber if the set of events were
     // forwarded from another IceStorm instance then do not queue the
     // events.
@@ -665,6 +776,28 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
         return true;
     }
 
+    //
+    // The subscriber record and filters are immutable, the events are
+    // matched before locking the subscriber to keep the publisher
+    // thread as short as possible in the critical section it shares
+    // with the threads sending the events.
+    //
+    EventDataSeq matched;
+    const EventDataSeq* toQueue = &events;
+    if(!_filterOperations.empty() || !_filterContext.empty())
+    {
+        for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+        {
+            if(matches(*p))
+            {
+                matched.push_back(*p);
+            }
+        }
+        toQueue = &matched;
+    }
+
+    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+
     switch(_state)
     {
     case SubscriberStateOffline:
@@ -683,9 +816,24 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
 
     case SubscriberStateOnline:
     {
-        for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+        if(toQueue->empty())
         {
-            if(static_cast<int>(_events.size()) == _instance->sendQueueSizeMax())
+            break;
+        }
+
+        IceUtil::Time now = _observer ? IceUtil::Time::now(IceUtil::Time::Monotonic) : IceUtil::Time();
+        const int sendQueueSizeMax = _instance->sendQueueSizeMax();
+        Ice::Int queued = 0;
+        for(EventDataSeq::const_iterator p = toQueue->begin(); p != toQueue->end(); ++p)
+        {
+            // A conflated event replaces a queued event, the queue
+            // doesn't grow and the event isn't counted as queued.
+            if(!_conflationKey.empty() && conflate(now, *p))
+            {
+                continue;
+            }
+
+            if(static_cast<int>(_events.size()) == sendQueueSizeMax)
             {
                 if(_instance->sendQueueSizeMaxPolicy() == Instance::RemoveSubscriber)
                 {
@@ -694,15 +842,21 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
                 }
                 else // DropEvents
                 {
-                    _events.pop_front();
+                    dequeue();
                 }
             }
-            _events.push_back(*p);
+            _events.push_back(make_pair(now, *p));
+            ++queued;
+        }
+
+        if(queued == 0)
+        {
+            break;
         }
 
         if(_observer)
         {
-            _observer->queued(static_cast<Ice::Int>(events.size()));
+            _observer->queued(queued);
         }
         flush();
         break;
@@ -858,12 +1012,14 @@ Subscriber::error(bool dec, const Ice::Exception& e)
         _next = now + _instance->discardInterval();
         ++_currentRetry;
         _events.clear();
+        _conflated.clear();
         setState(SubscriberStateOffline);
     }
     // Errored out.
     else if(_state < SubscriberStateError)
     {
         _events.clear();
+        _conflated.clear();
         setState(SubscriberStateError);
 
         TraceLevelsPtr traceLevels = _instance->traceLevels();
@@ -898,10 +1054,7 @@ Subscriber::completed(const Ice::AsyncResultPtr& result)
         // Decrement the _outstanding count.
         --_outstanding;
         assert(_outstanding >= 0 && _outstanding < _maxOutstanding);
-        if(_observer)
-        {
-            _observer->delivered(_outstandingCount);
-        }
+        delivered(OutstandingEventsPtr::dynamicCast(result->getCookie()));
 
         //
         // A successful response means we're no longer retrying, we're
@@ -967,10 +1120,13 @@ Subscriber::Subscriber(
     _maxOutstanding(maxOutstanding),
     _proxy(proxy),
     _proxyReplica(proxy),
+    _filterOperations(toFilterOperations(rec.theQoS)),
+    _filterContext(toFilterContext(rec.theQoS)),
+    _conflationKey(toConflationKey(rec.theQoS)),
     _shutdown(false),
     _state(SubscriberStateOnline),
     _outstanding(0),
-    _outstandingCount(1),
+    _dequeued(0),
     _currentRetry(0)
 {
     if(_proxy && _instance->publisherReplicaProxy())
@@ -1041,6 +1197,178 @@ Subscriber::setState(Subscriber::SubscriberState state)
     }
 }
 
+bool
+Subscriber::matches(const EventDataPtr& event) const
+{
+    if(!_filterOperations.empty() && _filterOperations.find(event->op) == _filterOperations.end())
+    {
+        return false;
+    }
+
+    for(Ice::Context::const_iterator p = _filterContext.begin(); p != _filterContext.end(); ++p)
+    {
+        Ice::Context::const_iterator q = event->context.find(p->first);
+        if(q == event->context.end() || q->second != p->second)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+// Report the delivery of the events sent with a request to the
+// observer, with the time they waited since they were queued.
+//
+void
+Subscriber::delivered(const OutstandingEventsPtr& outstanding)
+{
+    if(!_observer)
+    {
+        return;
+    }
+
+    IceUtil::Time now = outstanding->times.empty() ? IceUtil::Time() :
+                                                     IceUtil::Time::now(IceUtil::Time::Monotonic);
+    IceUtil::Time time;
+    IceUtil::Time timeMax;
+    for(vector<IceUtil::Time>::const_iterator p = outstanding->times.begin(); p != outstanding->times.end(); ++p)
+    {
+        IceUtil::Time t = now - *p;
+        time += t;
+        if(t > timeMax)
+        {
+            timeMax = t;
+        }
+    }
+    _observer->delivered(outstanding->count, time.toMicroSeconds(), timeMax.toMicroSeconds());
+}
+
+//
+// Replace the queued event with the same conflation key value as the
+// given event, if any. The queue therefore never holds more than one
+// event per key value, which bounds the queue of a slow subscriber by
+// the number of key values rather than by the publishing rate. The
+// replacing event keeps its own queuing time.
+//
+// _conflated maps each key value to the position of its queued event,
+// positions are counted from the first event ever queued so they don't
+// change when events are dequeued. If the key value isn't queued, the
+// caller must queue the event.
+//
+bool
+Subscriber::conflate(const IceUtil::Time& queued, const EventDataPtr& event)
+{
+    Ice::Context::const_iterator key = event->context.find(_conflationKey);
+    if(key == event->context.end())
+    {
+        return false;
+    }
+
+    Ice::Long position = _dequeued + static_cast<Ice::Long>(_events.size());
+    pair<map<string, Ice::Long>::iterator, bool> p = _conflated.insert(make_pair(key->second, position));
+    if(p.second)
+    {
+        return false;
+    }
+
+    assert(p.first->second >= _dequeued && p.first->second < position);
+    _events[static_cast<size_t>(p.first->second - _dequeued)] = make_pair(queued, event);
+    return true;
+}
+
+//
+// Remove the event at the front of the queue and return it with its
+// queuing time.
+//
+pair<IceUtil::Time, EventDataPtr>
+Subscriber::dequeue()
+{
+    assert(!_events.empty());
+    pair<IceUtil::Time, EventDataPtr> e = _events.front();
+    _events.pop_front();
+
+    if(!_conflationKey.empty())
+    {
+        Ice::Context::const_iterator key = e.second->context.find(_conflationKey);
+        if(key != e.second->context.end())
+        {
+            map<string, Ice::Long>::iterator p = _conflated.find(key->second);
+            if(p != _conflated.end() && p->second == _dequeued)
+            {
+                _conflated.erase(p);
+            }
+        }
+        ++_dequeued;
+    }
+    return e;
+}
+
+EventHistory::EventHistory(const InstancePtr& instance) :
+    _sizeMax(static_cast<size_t>(max(instance->replaySizeMax(), 0))),
+    _timeout(instance->replayTimeout())
+{
+}
+
+void
+EventHistory::add(const EventDataSeq& events)
+{
+    if(_sizeMax == 0)
+    {
+        return;
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+    {
+        if(_events.size() == _sizeMax)
+        {
+            _events.pop_front();
+        }
+        _events.push_back(make_pair(now, *p));
+    }
+    expire(now);
+}
+
+bool
+EventHistory::replay(const SubscriberPtr& subscriber, const QoS& qos)
+{
+    QoS::const_iterator p = qos.find("replay");
+    if(p == qos.end() || _events.empty())
+    {
+        return true;
+    }
+
+    int count = atoi(p->second.c_str());
+    if(count <= 0)
+    {
+        return true;
+    }
+
+    expire(IceUtil::Time::now(IceUtil::Time::Monotonic));
+
+    EventDataSeq events;
+    size_t first = _events.size() - min(_events.size(), static_cast<size_t>(count));
+    for(size_t i = first; i < _events.size(); ++i)
+    {
+        events.push_back(_events[i].second);
+    }
+    return events.empty() || subscriber->queue(false, events);
+}
+
+void
+EventHistory::expire(const IceUtil::Time& now)
+{
+    if(_timeout == IceUtil::Time())
+    {
+        return;
+    }
+    while(!_events.empty() && now - _events.front().first > _timeout)
+    {
+        _events.pop_front();
+    }
+}
+
 bool
 IceStorm::operator==(const SubscriberPtr& subscriber, const Ice::Identity& id)
 {
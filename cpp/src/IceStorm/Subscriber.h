@@ -16,6 +16,10 @@
 #include <Ice/ObserverHelper.h>
 #include <IceUtil/RecMutex.h>
 
+#include <deque>
+#include <map>
+#include <set>
+
 namespace IceStorm
 {
 
@@ -25,6 +29,39 @@ typedef IceUtil::Handle<Instance> InstancePtr;
 class Subscriber;
 typedef IceUtil::Handle<Subscriber> SubscriberPtr;
 
+//
+// The queued events with their queuing time. The time is only set
+// if the subscriber is observed.
+//
+typedef std::deque<std::pair<IceUtil::Time, EventDataPtr> > QueuedEventSeq;
+
+//
+// The events sent with an outstanding request, passed as the request
+// cookie. The queuing times of the events are used to compute their
+// delivery latency.
+//
+class OutstandingEvents : public Ice::LocalObject
+{
+public:
+
+    OutstandingEvents() : count(0)
+    {
+    }
+
+    void add(const IceUtil::Time& queued)
+    {
+        ++count;
+        if(queued != IceUtil::Time())
+        {
+            times.push_back(queued);
+        }
+    }
+
+    Ice::Int count;
+    std::vector<IceUtil::Time> times;
+};
+typedef IceUtil::Handle<OutstandingEvents> OutstandingEventsPtr;
+
 class Subscriber : public IceUtil::Shared
 {
 public:
@@ -66,6 +103,10 @@ public:
 protected:
 
     void setState(SubscriberState);
+    void delivered(const OutstandingEventsPtr&);
+    bool matches(const EventDataPtr&) const;
+    bool conflate(const IceUtil::Time&, const EventDataPtr&);
+    std::pair<IceUtil::Time, EventDataPtr> dequeue();
 
     Subscriber(const InstancePtr&, const IceStorm::SubscriberRecord&, const Ice::ObjectPrx&, int, int);
 
@@ -76,6 +117,9 @@ protected:
     const int _maxOutstanding; // The maximum number of oustanding events.
     const Ice::ObjectPrx _proxy; // The per subscriber object proxy, if any.
     const Ice::ObjectPrx _proxyReplica; // The replicated per subscriber object proxy, if any.
+    const std::set<std::string> _filterOperations; // The operations to send, empty to send all.
+    const Ice::Context _filterContext; // The context entries an event must carry to be sent.
+    const std::string _conflationKey; // The context entry conflating queued events, if any.
 
     IceUtil::Monitor<IceUtil::RecMutex> _lock;
 
@@ -84,8 +128,9 @@ protected:
     SubscriberState _state; // The subscriber state.
 
     int _outstanding; // The current number of outstanding responses.
-    int _outstandingCount; // The current number of outstanding events when batching events (only used for metrics).
-    EventDataSeq _events; // The queue of events to send.
+    QueuedEventSeq _events; // The queue of events to send.
+    std::map<std::string, Ice::Long> _conflated; // The position of the queued event of each conflation key value.
+    Ice::Long _dequeued; // The number of events dequeued, if conflating.
 
     // The next time to try sending a new event if we're offline.
     IceUtil::Time _next;
@@ -94,6 +139,49 @@ protected:
     IceInternal::ObserverHelperT<IceStorm::Instrumentation::SubscriberObserver> _observer;
 };
 
+//
+// An immutable copy of the subscribers of a topic. The topic shares
+// it between publish calls until its subscribers change, so
+// publishing an event doesn't copy the subscriber list.
+//
+class SubscriberSnapshot : public IceUtil::Shared
+{
+public:
+
+    SubscriberSnapshot(const std::vector<SubscriberPtr>& s) : subscribers(s)
+    {
+    }
+
+    const std::vector<SubscriberPtr> subscribers;
+};
+
+//
+// The most recent events published on a topic, replayed to the new
+// subscribers which request it with the "replay" QoS. The number and
+// age of the retained events are bounded by the Replay.SizeMax and
+// Replay.Timeout properties. This class isn't thread safe, it's
+// protected by the topic mutex.
+//
+class EventHistory
+{
+public:
+
+    EventHistory(const InstancePtr&);
+
+    void add(const EventDataSeq&);
+
+    // Returns false if the subscriber should be reaped.
+    bool replay(const SubscriberPtr&, const QoS&);
+
+private:
+
+    void expire(const IceUtil::Time&);
+
+    const size_t _sizeMax;
+    const IceUtil::Time _timeout;
+    std::deque<std::pair<IceUtil::Time, EventDataPtr> > _events;
+};
+
 bool operator==(const IceStorm::SubscriberPtr&, const Ice::Identity&);
 bool operator==(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 bool operator!=(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
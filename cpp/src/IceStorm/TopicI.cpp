@@ -346,6 +346,7 @@ TopicImpl::TopicImpl(
     _instance(instance),
     _name(name),
     _id(id),
+    _history(instance),
     _destroyed(false),
     _lluMap(_instance->lluMap()),
     _subscriberMap(_instance->subscriberMap())
@@ -414,6 +415,7 @@ TopicImpl::TopicImpl(
                 //
                 SubscriberPtr subscriber = Subscriber::create(_instance, *p);
                 _subscribers.push_back(subscriber);
+                _subscribersSnapshot = 0;
             }
             catch(const Ice::Exception& ex)
             {
@@ -575,9 +577,22 @@ TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
     }
 
     _subscribers.push_back(subscriber);
+    _subscribersSnapshot = 0;
+    bool replayed = _history.replay(subscriber, qos);
 
     _instance->observers()->addSubscriber(llu, _name, record);
 
+    //
+    // Remove the subscriber if it's in error after queuing the replayed
+    // events, like publish does.
+    //
+    if(!replayed && subscriber->reap())
+    {
+        Ice::IdentitySeq ids;
+        ids.push_back(subscriber->id());
+        removeSubscribers(ids);
+    }
+
     return subscriber->proxy();
 }
 
@@ -687,6 +702,7 @@ TopicImpl::link(const TopicPrx& topic, Ice::Int cost)
     }
 
     _subscribers.push_back(subscriber);
+    _subscribersSnapshot = 0;
 
     _instance->observers()->addSubscriber(llu, _name, record);
 }
@@ -875,6 +891,7 @@ TopicImpl::update(const SubscriberRecordSeq& records)
             {
                 (*p)->destroy();
                 p = _subscribers.erase(p);
+                _subscribersSnapshot = 0;
             }
             else
             {
@@ -899,6 +916,7 @@ TopicImpl::update(const SubscriberRecordSeq& records)
         {
             SubscriberPtr subscriber = Subscriber::create(_instance, *p);
             _subscribers.push_back(subscriber);
+            _subscribersSnapshot = 0;
         }
     }
 }
@@ -975,10 +993,11 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
 
         //
-        // Copy of the subscriber list so that event publishing can occur
-        // in parallel.
+        // Snapshot of the subscriber list so that event publishing can
+        // occur in parallel. The snapshot is only copied when the
+        // subscribers change.
         //
-        vector<SubscriberPtr> copy;
+        SubscriberSnapshotPtr snapshot;
         {
             IceUtil::Mutex::Lock sync(_subscribersMutex);
             if(_observer)
@@ -992,14 +1011,20 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
                     _observer->published();
                 }
             }
-            copy = _subscribers;
+            _history.add(events);
+            if(!_subscribersSnapshot)
+            {
+                _subscribersSnapshot = new SubscriberSnapshot(_subscribers);
+            }
+            snapshot = _subscribersSnapshot;
         }
 
         //
         // Queue each event, gathering a list of those subscribers that
         // must be reaped.
         //
-        for(vector<SubscriberPtr>::const_iterator p = copy.begin(); p != copy.end(); ++p)
+        const vector<SubscriberPtr>& subscribers = snapshot->subscribers;
+        for(vector<SubscriberPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
         {
             if(!(*p)->queue(forwarded, events) && (*p)->reap())
             {
@@ -1100,6 +1125,7 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
     }
 
     _subscribers.push_back(subscriber);
+    _subscribersSnapshot = 0;
 }
 
 void
@@ -1158,6 +1184,7 @@ TopicImpl::observerRemoveSubscriber(const LogUpdate& llu, const Ice::IdentitySeq
         {
             (*p)->destroy();
             _subscribers.erase(p);
+            _subscribersSnapshot = 0;
         }
     }
 }
@@ -1265,6 +1292,7 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
         (*p)->destroy();
     }
     _subscribers.clear();
+    _subscribersSnapshot = 0;
 
     _instance->topicAdapter()->remove(_id);
 
@@ -1327,6 +1355,7 @@ TopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
             {
                 (*p)->destroy();
                 _subscribers.erase(p);
+                _subscribersSnapshot = 0;
             }
         }
 
@@ -14,6 +14,7 @@
 #include <IceStorm/Election.h>
 #include <IceStorm/Instrumentation.h>
 #include <IceStorm/Util.h>
+#include <IceStorm/Subscriber.h>
 #include <Ice/ObserverHelper.h>
 #include <list>
 
@@ -24,9 +25,6 @@ namespace IceStorm
 class PersistentInstance;
 typedef IceUtil::Handle<PersistentInstance> PersistentInstancePtr;
 
-class Subscriber;
-typedef IceUtil::Handle<Subscriber> SubscriberPtr;
-
 class TopicImpl : public IceUtil::Shared
 {
 public:
@@ -99,6 +97,8 @@ private:
     // was the fastest of the three.
     //
     std::vector<SubscriberPtr> _subscribers;
+    SubscriberSnapshotPtr _subscribersSnapshot; // Reset when _subscribers changes.
+    EventHistory _history; // Events replayed to new subscribers.
 
     bool _destroyed; // Has this Topic been destroyed?
 
@@ -101,6 +101,7 @@ TransientTopicImpl::TransientTopicImpl(
     _instance(instance),
     _name(name),
     _id(id),
+    _history(instance),
     _destroyed(false)
 {
     //
@@ -255,10 +256,13 @@ TransientTopicImpl::subscribe(const QoS& origQoS, const Ice::ObjectPrx& obj, con
         // subscriber list and remove it from the database.
         (*p)->destroy();
         _subscribers.erase(p);
+        _subscribersSnapshot = 0;
     }
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _subscribersSnapshot = 0;
+    replay(subscriber, qos);
 }
 
 Ice::ObjectPrx
@@ -315,6 +319,8 @@ TransientTopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPr
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _subscribersSnapshot = 0;
+    replay(subscriber, qos);
 
     return subscriber->proxy();
 }
@@ -354,6 +360,7 @@ TransientTopicImpl::unsubscribe(const Ice::ObjectPrx& subscriber, const Ice::Cur
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        _subscribersSnapshot = 0;
     }
 }
 
@@ -401,6 +408,7 @@ TransientTopicImpl::link(const TopicPrx& topic, Ice::Int cost, const Ice::Curren
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _subscribersSnapshot = 0;
 }
 
 void
@@ -445,6 +453,7 @@ TransientTopicImpl::unlink(const TopicPrx& topic, const Ice::Current&)
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        _subscribersSnapshot = 0;
     }
 }
 
@@ -515,6 +524,7 @@ TransientTopicImpl::destroy(const Ice::Current&)
         (*p)->destroy();
     }
     _subscribers.clear();
+    _subscribersSnapshot = 0;
 }
 
 void
@@ -540,13 +550,19 @@ void
 TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
 {
     //
-    // Copy of the subscriber list so that event publishing can occur
-    // in parallel.
+    // Snapshot of the subscriber list so that event publishing can
+    // occur in parallel. The snapshot is only copied when the
+    // subscribers change.
     //
-    vector<SubscriberPtr> copy;
+    SubscriberSnapshotPtr snapshot;
     {
         Lock sync(*this);
-        copy = _subscribers;
+        _history.add(events);
+        if(!_subscribersSnapshot)
+        {
+            _subscribersSnapshot = new SubscriberSnapshot(_subscribers);
+        }
+        snapshot = _subscribersSnapshot;
     }
 
     //
@@ -554,7 +570,8 @@ TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
     // must be reaped.
     //
     vector<Ice::Identity> e;
-    for(vector<SubscriberPtr>::const_iterator p = copy.begin(); p != copy.end(); ++p)
+    const vector<SubscriberPtr>& subscribers = snapshot->subscribers;
+    for(vector<SubscriberPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
     {
         if(!(*p)->queue(forwarded, events) && (*p)->reap())
         {
@@ -573,7 +590,7 @@ TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
         {
             //
             // Its possible for the subscriber to already have been
-            // removed since the copy is iterated over outside of
+            // removed since the snapshot is iterated over outside of
             // mutex protection.
             //
             // Note that although this could be quicker if we used a
@@ -594,11 +611,32 @@ TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
                 //
                 subscriber->destroy();
                 _subscribers.erase(q);
+                _subscribersSnapshot = 0;
             }
         }
     }
 }
 
+//
+// Replay the retained events to a new subscriber and remove the
+// subscriber if it's in error afterwards, like publish does. Must be
+// called with the topic locked, after adding the subscriber.
+//
+void
+TransientTopicImpl::replay(const SubscriberPtr& subscriber, const QoS& qos)
+{
+    if(!_history.replay(subscriber, qos) && subscriber->reap())
+    {
+        vector<SubscriberPtr>::iterator p = find(_subscribers.begin(), _subscribers.end(), subscriber->id());
+        if(p != _subscribers.end())
+        {
+            subscriber->destroy();
+            _subscribers.erase(p);
+            _subscribersSnapshot = 0;
+        }
+    }
+}
+
 void
 TransientTopicImpl::shutdown()
 {
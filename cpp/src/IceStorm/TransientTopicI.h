@@ -11,6 +11,7 @@
 #define TRANSIENT_TOPIC_I_H
 
 #include <IceStorm/IceStormInternal.h>
+#include <IceStorm/Subscriber.h>
 
 namespace IceStorm
 {
@@ -19,9 +20,6 @@ namespace IceStorm
 class Instance;
 typedef IceUtil::Handle<Instance> InstancePtr;
 
-class Subscriber;
-typedef IceUtil::Handle<Subscriber> SubscriberPtr;
-
 class TransientTopicImpl : public TopicInternal, public IceUtil::Mutex
 {
 public:
@@ -52,6 +50,8 @@ public:
 
 private:
 
+    void replay(const SubscriberPtr&, const QoS&);
+
     //
     // Immutable members.
     //
@@ -70,6 +70,8 @@ private:
     // was the fastest of the three.
     //
     std::vector<SubscriberPtr> _subscribers;
+    SubscriberSnapshotPtr _subscribersSnapshot; // Reset when _subscribers changes.
+    EventHistory _history; // Events replayed to new subscribers.
 
     bool _destroyed; // Has this Topic been destroyed?
 };
@@ -80,6 +80,67 @@ isConstexprType(const TypePtr& type)
 }
 
 
+//
+// Can sequences of the given struct be marshaled with a single memcpy? The
+// data members must all be fixed-size numeric types or such structs. The
+// generated code also checks that the C++ struct has no padding.
+//
+bool
+isBulkStreamable(const StructPtr& p)
+{
+    if(findMetaData(p->getMetaData(), false) == "%class")
+    {
+        return false;
+    }
+
+    DataMemberList members = p->dataMembers();
+    for(DataMemberList::const_iterator i = members.begin(); i != members.end(); ++i)
+    {
+        BuiltinPtr bp = BuiltinPtr::dynamicCast((*i)->type());
+        if(bp)
+        {
+            switch(bp->kind())
+            {
+                case Builtin::KindByte:
+                case Builtin::KindShort:
+                case Builtin::KindInt:
+                case Builtin::KindLong:
+                case Builtin::KindFloat:
+                case Builtin::KindDouble:
+                {
+                    break;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            StructPtr s = StructPtr::dynamicCast((*i)->type());
+            if(!s || !isBulkStreamable(s))
+            {
+                return false;
+            }
+        }
+    }
+    return !members.empty();
+}
+
+void
+writeBulkStreamableTraits(IceUtilInternal::Output& out, const StructPtr& p, const string& scoped)
+{
+    if(isBulkStreamable(p))
+    {
+        out << nl << "template<>";
+        out << nl << "struct IsBulkStreamable< " << scoped << ">";
+        out << sb;
+        out << nl << "static const bool value = sizeof(" << scoped << ") == " << p->minWireSize() << ";";
+        out << eb << ";" << nl;
+    }
+}
+
 string
 getDeprecateSymbol(const ContainedPtr& p1, const ContainedPtr& p2)
 {
@@ -4426,6 +4487,8 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
         }
         H << eb << ";" << nl;
 
+        writeBulkStreamableTraits(H, p, fixKwd(scoped));
+
         writeStreamHelpers(H, p, p->dataMembers(), false, true, false);
     }
     return false;
@@ -7470,6 +7533,8 @@ Slice::Gen::Cpp11StreamVisitor::visitStructStart(const StructPtr& p)
     H << nl << "static const bool fixedLength = " << (p->isVariableLength() ? "false" : "true") << ";";
     H << eb << ";" << nl;
 
+    writeBulkStreamableTraits(H, p, scoped);
+
     writeStreamHelpers(H, p, p->dataMembers(), false, false, true);
 
     return false;
@@ -879,6 +879,89 @@ private:
     ThrowType _t;
 };
 typedef IceUtil::Handle<Thrower> ThrowerPtr;
+
+class ReplyPriorityCallback : public CallbackBase
+{
+public:
+
+    ReplyPriorityCallback() :
+        _held(false),
+        _released(false),
+        _firstCompleted(false),
+        _lastCompleted(true)
+    {
+    }
+
+    void ping()
+    {
+        //
+        // Hold the client thread pool thread, no replies are read
+        // until release() is called.
+        //
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _held = true;
+        _monitor.notifyAll();
+        while(!_released)
+        {
+            _monitor.wait();
+        }
+    }
+
+    void opWithResult(int r)
+    {
+        test(r == 15);
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+            _firstCompleted = _results.front()->isCompleted();
+            _lastCompleted = _results.back()->isCompleted();
+        }
+        called();
+    }
+
+    void ex(const Ice::Exception&)
+    {
+        test(false);
+    }
+
+    void waitHeld()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        while(!_held)
+        {
+            _monitor.wait();
+        }
+    }
+
+    void release(const vector<Ice::AsyncResultPtr>& results)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _results = results;
+        _released = true;
+        _monitor.notifyAll();
+    }
+
+    bool firstCompleted()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        return _firstCompleted;
+    }
+
+    bool lastCompleted()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        return _lastCompleted;
+    }
+
+private:
+
+    IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    bool _held;
+    bool _released;
+    vector<Ice::AsyncResultPtr> _results;
+    bool _firstCompleted;
+    bool _lastCompleted;
+};
+typedef IceUtil::Handle<ReplyPriorityCallback> ReplyPriorityCallbackPtr;
 #endif
 
 }
@@ -2161,6 +2244,80 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
 
         if(p->ice_getConnection() && protocol != "bt")
         {
+            cout << "testing reply priority with sending queue... " << flush;
+            {
+                //
+                // Queue several large replies followed by a small one. The small reply must be
+                // sent before the large replies that are still queued, but never before the large
+                // reply that is already being sent.
+                //
+                // The replies are read by a communicator with a single client thread pool thread
+                // and a small receive buffer. This thread is held by a ping callback until the
+                // server dispatched all the requests, so the large replies are queued on the server.
+                // The opWithResult callback runs in the same thread, when it runs only the large
+                // replies read before the small reply are completed.
+                //
+                const int size = 512 * 1024;
+                promise<void> held;
+                promise<void> release;
+                future<void> released = release.get_future();
+                promise<int> result;
+                bool firstCompleted = false;
+                bool lastCompleted = true;
+                vector<future<Ice::ByteSeq>> results;
+
+                Ice::InitializationData initData;
+                initData.properties = communicator->getProperties()->clone();
+                initData.properties->setProperty("Ice.ThreadPool.Client.Size", "1");
+                initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", "1");
+                initData.properties->setProperty("Ice.TCP.RcvSize", "50000");
+                Ice::CommunicatorHolder ich = Ice::initialize(initData);
+                auto q = Ice::uncheckedCast<Test::TestIntfPrx>(ich->stringToProxy(p->ice_toString()));
+                q->ice_ping();
+
+                q->ice_pingAsync(
+                    [&]()
+                    {
+                        held.set_value();
+                        released.wait();
+                    });
+                held.get_future().wait();
+
+                for(int i = 0; i < 8; ++i)
+                {
+                    results.push_back(q->opWithPayloadResultAsync(size));
+                }
+                q->opWithResultAsync(
+                    [&](int r)
+                    {
+                        firstCompleted = results.front().wait_for(chrono::seconds(0)) == future_status::ready;
+                        lastCompleted = results.back().wait_for(chrono::seconds(0)) == future_status::ready;
+                        result.set_value(r);
+                    },
+                    [&](exception_ptr ex)
+                    {
+                        result.set_exception(ex);
+                    });
+
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+                release.set_value();
+
+                test(result.get_future().get() == 15);
+                test(firstCompleted);
+                test(!lastCompleted);
+
+                for(vector<future<Ice::ByteSeq>>::iterator r = results.begin(); r != results.end(); ++r)
+                {
+                    Ice::ByteSeq seq = r->get();
+                    test(seq.size() == static_cast<size_t>(size));
+                    for(size_t i = 0; i < seq.size(); ++i)
+                    {
+                        test(seq[i] == static_cast<Ice::Byte>(i));
+                    }
+                }
+            }
+            cout << "ok" << endl;
+
             cout << "testing close connection with sending queue... " << flush;
             {
                 Ice::ByteSeq seq;
@@ -3715,6 +3872,61 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
 
     if(p->ice_getConnection() && protocol != "bt")
     {
+        cout << "testing reply priority with sending queue... " << flush;
+        {
+            //
+            // Queue several large replies followed by a small one. The small reply must be
+            // sent before the large replies that are still queued, but never before the large
+            // reply that is already being sent.
+            //
+            // The replies are read by a communicator with a single client thread pool thread
+            // and a small receive buffer. This thread is held by a ping callback until the
+            // server dispatched all the requests, so the large replies are queued on the server.
+            // The opWithResult callback runs in the same thread, when it runs only the large
+            // replies read before the small reply are completed.
+            //
+            const int size = 512 * 1024;
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.ThreadPool.Client.Size", "1");
+            initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", "1");
+            initData.properties->setProperty("Ice.TCP.RcvSize", "50000");
+            Ice::CommunicatorHolder ich = Ice::initialize(initData);
+            Test::TestIntfPrx q = Test::TestIntfPrx::uncheckedCast(ich->stringToProxy(p->ice_toString()));
+            q->ice_ping();
+
+            ReplyPriorityCallbackPtr cb = new ReplyPriorityCallback();
+            q->begin_ice_ping(Ice::newCallback_Object_ice_ping(cb, &ReplyPriorityCallback::ping,
+                                                               &ReplyPriorityCallback::ex));
+            cb->waitHeld();
+
+            vector<Ice::AsyncResultPtr> results;
+            for(int i = 0; i < 8; ++i)
+            {
+                results.push_back(q->begin_opWithPayloadResult(size));
+            }
+            q->begin_opWithResult(Test::newCallback_TestIntf_opWithResult(cb, &ReplyPriorityCallback::opWithResult,
+                                                                          &ReplyPriorityCallback::ex));
+
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+            cb->release(results);
+
+            cb->check();
+            test(cb->firstCompleted());
+            test(!cb->lastCompleted());
+
+            for(vector<Ice::AsyncResultPtr>::const_iterator r = results.begin(); r != results.end(); ++r)
+            {
+                Ice::ByteSeq seq = q->end_opWithPayloadResult(*r);
+                test(seq.size() == static_cast<size_t>(size));
+                for(size_t i = 0; i < seq.size(); ++i)
+                {
+                    test(seq[i] == static_cast<Ice::Byte>(i));
+                }
+            }
+        }
+        cout << "ok" << endl;
+
         cout << "testing close connection with sending queue... " << flush;
         {
             Ice::ByteSeq seq;
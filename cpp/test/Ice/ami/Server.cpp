@@ -62,6 +62,12 @@ main(int argc, char* argv[])
         //
         initData.properties->setProperty("Ice.TCP.RcvSize", "50000");
 
+        //
+        // Limit the send buffer size, the reply priority test relies on
+        // the replies being queued when the client doesn't read them.
+        //
+        initData.properties->setProperty("Ice.TCP.SndSize", "50000");
+
         Ice::CommunicatorHolder ich = Ice::initialize(argc, argv, initData);
         return run(argc, argv, ich.communicator());
     }
@@ -46,6 +46,17 @@ TestIntfI::opWithPayload(ICE_IN(Ice::ByteSeq), const Ice::Current&)
 {
 }
 
+Ice::ByteSeq
+TestIntfI::opWithPayloadResult(Ice::Int size, const Ice::Current&)
+{
+    Ice::ByteSeq seq(static_cast<size_t>(size));
+    for(size_t i = 0; i < seq.size(); ++i)
+    {
+        seq[i] = static_cast<Ice::Byte>(i);
+    }
+    return seq;
+}
+
 void
 TestIntfI::opBatch(const Ice::Current&)
 {
@@ -27,6 +27,7 @@ public:
     virtual void opWithUE(const Ice::Current&);
     virtual int opWithResultAndUE(const Ice::Current&);
     virtual void opWithPayload(ICE_IN(Ice::ByteSeq), const Ice::Current&);
+    virtual Ice::ByteSeq opWithPayloadResult(Ice::Int, const Ice::Current&);
     virtual void opBatch(const Ice::Current&);
     virtual Ice::Int opBatchCount(const Ice::Current&);
     virtual void opWithArgs(Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&, Ice::Int&,
@@ -805,6 +805,30 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing connection pool... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Default.ConnectionPoolSize", "2");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter81", "default");
+        string proxy = communicator->proxyToString(adapter->getTestIntf());
+        TestIntfPrxPtr test = ICE_UNCHECKED_CAST(TestIntfPrx, comm->stringToProxy(proxy)->ice_connectionCached(false));
+
+        set<Ice::ConnectionPtr> connections;
+        for(int i = 0; i < 10; ++i)
+        {
+            test(test->getAdapterName() == "Adapter81");
+            connections.insert(test->ice_getConnection());
+        }
+        test(connections.size() == 2);
+
+        com->deactivateObjectAdapter(adapter);
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing endpoint mode filtering... " << flush;
     {
         vector<RemoteObjectAdapterPrxPtr> adapters;
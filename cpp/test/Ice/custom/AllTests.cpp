@@ -605,6 +605,63 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(t->ice_ids()[1] == Test::TestIntfPrx::ice_staticId());
     cout << "ok" << endl;
 
+    cout << "testing string converter with Ice.StringConverter.SkipASCII... " << flush;
+    {
+        //
+        // The test string converter reverses the strings, it's only
+        // skipped for ASCII strings if Ice.StringConverter.SkipASCII is
+        // set, both when reading and writing strings.
+        //
+        Ice::OutputStream out(communicator);
+        out.write(string("Hello"));
+        out.write(string("H\xc3\xa9llo"));
+        vector<Ice::Byte> data;
+        out.finished(data);
+
+        string s1;
+        string s2;
+        {
+            Ice::InputStream in(communicator, data);
+            in.read(s1);
+            in.read(s2);
+            test(s1 == "Hello");
+            test(s2 == "H\xc3\xa9llo");
+        }
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.StringConverter.SkipASCII", "1");
+        Ice::CommunicatorPtr skipASCII = Ice::initialize(initData);
+        {
+            Ice::InputStream in(skipASCII, data);
+            in.read(s1);
+            in.read(s2);
+            test(s1 == "olleH");
+            test(s2 == "H\xc3\xa9llo");
+        }
+        {
+            Ice::OutputStream out2(skipASCII);
+            out2.write(string("Hello"));
+            out2.write(string("H\xc3\xa9llo"));
+            vector<Ice::Byte> data2;
+            out2.finished(data2);
+
+            Ice::InputStream in(communicator, data2);
+            in.read(s1);
+            in.read(s2);
+            test(s1 == "olleH");
+            test(s2 == "H\xc3\xa9llo");
+
+            Ice::InputStream in2(skipASCII, data2);
+            in2.read(s1);
+            in2.read(s2);
+            test(s1 == "Hello");
+            test(s2 == "H\xc3\xa9llo");
+        }
+        skipASCII->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing alternate strings... " << flush;
     {
         Util::string_view in = "Hello World!";
@@ -146,6 +146,33 @@ public:
 };
 
 
+//
+// Copies and releases a reference to an object of a collectable graph
+// while the graph is collected by another thread.
+//
+class ReleaseThread : public IceUtil::Thread
+{
+public:
+
+    ReleaseThread(const NLPtr& nl) : _nl(nl)
+    {
+    }
+
+    virtual void run()
+    {
+        for(int i = 0; i < 1000; ++i)
+        {
+            NLPtr nl = _nl;
+        }
+        _nl = 0;
+    }
+
+private:
+
+    NLPtr _nl;
+};
+typedef IceUtil::Handle<ReleaseThread> ReleaseThreadPtr;
+
 class MyApplication : public Ice::Application
 {
 public:
@@ -529,6 +556,38 @@ MyApplication::run(int argc, char* argv[])
     test(getNum() == 0);
 
     cout << "ok" << endl;
+
+    cout << "testing concurrent release during collection... " << flush;
+    {
+        for(int i = 0; i < 100; ++i)
+        {
+            vector<IceUtil::ThreadControl> threads;
+            {
+                NNPtr nn1 = new NN;
+                NNPtr nn2 = new NN;
+                NLPtr nl = new NL;
+                nn1->l = nl;
+                nn1->n = nn2;
+                nn2->l = nl;
+                nn2->n = nn1;
+                nn1->ice_collectable(true);
+                test(getNum() == 3);
+
+                for(int j = 0; j < 4; ++j)
+                {
+                    ReleaseThreadPtr t = new ReleaseThread(nl);
+                    threads.push_back(t->start());
+                }
+            }
+            for(vector<IceUtil::ThreadControl>::iterator p = threads.begin(); p != threads.end(); ++p)
+            {
+                p->join();
+            }
+            test(getNum() == 0);
+        }
+    }
+    cout << "ok" << endl;
+
     return 0;
 }
 
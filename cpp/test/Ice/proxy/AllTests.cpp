@@ -461,6 +461,63 @@ allTests(const Ice::CommunicatorPtr& communicator)
 
     cout << "ok" << endl;
 
+    cout << "testing reference sharing... " << flush;
+    {
+        //
+        // Proxies created from identical strings share the same reference.
+        //
+        Ice::ObjectPrxPtr p1 = communicator->stringToProxy("shared:" + endp);
+        Ice::ObjectPrxPtr p2 = communicator->stringToProxy("shared:" + endp);
+        test(p1->ice_toString() == p2->ice_toString());
+        test(p1->__reference().get() == p2->__reference().get());
+        test(communicator->stringToProxy("shared2:" + endp)->__reference().get() != p1->__reference().get());
+
+        //
+        // Proxies created from properties aren't shared, they depend on the
+        // proxy properties at the time of the call.
+        //
+        prop->setProperty("Shared.Proxy", "shared:" + endp);
+        Ice::ObjectPrxPtr p3 = communicator->propertyToProxy("Shared.Proxy");
+        test(p3->ice_toString() == p1->ice_toString());
+        test(p3->__reference().get() != p1->__reference().get());
+        test(communicator->propertyToProxy("Shared.Proxy")->__reference().get() != p3->__reference().get());
+
+        prop->setProperty("Shared.Proxy.Secure", "1");
+        test(communicator->propertyToProxy("Shared.Proxy")->ice_isSecure());
+        test(!communicator->stringToProxy("shared:" + endp)->ice_isSecure());
+
+        prop->setProperty("Shared.Proxy", "");
+        prop->setProperty("Shared.Proxy.Secure", "");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing endpoint sharing... " << flush;
+    {
+        //
+        // Endpoints unmarshaled from identical bytes are shared, opaque
+        // endpoints aren't.
+        //
+        Ice::ObjectPrxPtr prx = communicator->stringToProxy("shared:" + endp + ":opaque -t 99 -e 1.0 -v abch");
+        Ice::OutputStream out(communicator);
+        out.write(prx);
+        out.write(prx);
+        vector<Ice::Byte> data;
+        out.finished(data);
+
+        Ice::InputStream in(communicator, data);
+        Ice::ObjectPrxPtr p1;
+        Ice::ObjectPrxPtr p2;
+        in.read(p1);
+        in.read(p2);
+        Ice::EndpointSeq e1 = p1->ice_getEndpoints();
+        Ice::EndpointSeq e2 = p2->ice_getEndpoints();
+        test(e1.size() == 2 && e2.size() == 2);
+        test(e1[0].get() == e2[0].get());
+        test(e1[1].get() != e2[1].get());
+        test(e1[1]->toString() == e2[1]->toString());
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxyToProperty... " << flush;
 
     b1 = communicator->stringToProxy("test");
@@ -18,6 +18,95 @@ using namespace Test;
 using namespace Test::Sub;
 using namespace Test2::Sub2;
 
+//
+// Stateful allocator used to check that unmarshaling a sequence preserves
+// the allocator of the sequence. Each allocator counts its allocations,
+// allocations of default-constructed allocators are counted by
+// defaultAllocations.
+//
+int defaultAllocations = 0;
+
+template<typename T>
+class CountingAllocator
+{
+public:
+
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template<typename U> struct rebind
+    {
+        typedef CountingAllocator<U> other;
+    };
+
+    CountingAllocator() : count(&defaultAllocations)
+    {
+    }
+
+    explicit CountingAllocator(int* c) : count(c)
+    {
+    }
+
+    template<typename U> CountingAllocator(const CountingAllocator<U>& other) : count(other.count)
+    {
+    }
+
+    pointer allocate(size_type n, const void* = 0)
+    {
+        ++*count;
+        return static_cast<pointer>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(pointer p, size_type)
+    {
+        ::operator delete(p);
+    }
+
+    size_type max_size() const
+    {
+        return static_cast<size_type>(-1) / sizeof(T);
+    }
+
+    pointer address(reference r) const
+    {
+        return &r;
+    }
+
+    const_pointer address(const_reference r) const
+    {
+        return &r;
+    }
+
+    void construct(pointer p, const T& v)
+    {
+        new(p) T(v);
+    }
+
+    void destroy(pointer p)
+    {
+        p->~T();
+    }
+
+    int* count;
+};
+
+template<typename T, typename U> bool
+operator==(const CountingAllocator<T>& lhs, const CountingAllocator<U>& rhs)
+{
+    return lhs.count == rhs.count;
+}
+
+template<typename T, typename U> bool
+operator!=(const CountingAllocator<T>& lhs, const CountingAllocator<U>& rhs)
+{
+    return lhs.count != rhs.count;
+}
+
 #ifdef ICE_CPP11_MAPPING
 class TestObjectWriter : public Ice::ValueHelper<TestObjectWriter, Ice::Value>
 #else
@@ -787,6 +876,116 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
 #endif
     }
 
+    {
+        Ice::StringSeq arr;
+        arr.push_back("string1");
+        arr.push_back("string2");
+        Ice::OutputStream out(communicator);
+        out.write(arr);
+        out.finished(data);
+
+        Ice::InputStream in(communicator, data);
+        int allocations = 0;
+        defaultAllocations = 0;
+        vector<string, CountingAllocator<string> > arr2((CountingAllocator<string>(&allocations)));
+        in.read(arr2);
+        test(arr2.get_allocator().count == &allocations);
+        test(allocations > 0);
+        test(defaultAllocations == 0);
+        test(arr2.size() == 2 && arr2[0] == "string1" && arr2[1] == "string2");
+    }
+
+    {
+#ifndef ICE_BIG_ENDIAN
+        if(sizeof(FixedStruct) == 24)
+        {
+            test(Ice::IsBulkStreamable<FixedStruct>::value);
+        }
+#endif
+
+        FixedStructS arr;
+        for(int i = 0; i < 4; ++i)
+        {
+            FixedStruct s;
+            s.d = 1.5 * i;
+            s.l = 2 * i;
+            s.i = 3 * i;
+            s.sh = static_cast<Ice::Short>(4 * i);
+            s.b1 = static_cast<Ice::Byte>(5 * i);
+            s.b2 = static_cast<Ice::Byte>(6 * i);
+            arr.push_back(s);
+        }
+        Ice::OutputStream out(communicator);
+        out.write(arr);
+        out.finished(data);
+        test(data.size() == 1 + arr.size() * 24);
+
+        //
+        // The encoding must be the same as the member by member encoding.
+        //
+        Ice::OutputStream out2(communicator);
+        out2.write(arr[1].d);
+        out2.write(arr[1].l);
+        out2.write(arr[1].i);
+        out2.write(arr[1].sh);
+        out2.write(arr[1].b1);
+        out2.write(arr[1].b2);
+        vector<Ice::Byte> data2;
+        out2.finished(data2);
+        test(data2.size() == 24);
+        test(equal(data2.begin(), data2.end(), data.begin() + 1 + 24));
+
+        Ice::OutputStream out3(communicator);
+        out3.write(arr[1]);
+        vector<Ice::Byte> data3;
+        out3.finished(data3);
+        test(data3 == data2);
+
+        Ice::InputStream in(communicator, data);
+        FixedStructS arr2;
+        in.read(arr2);
+        test(arr2 == arr);
+
+        Ice::InputStream in3(communicator, data3);
+        FixedStruct s2;
+        in3.read(s2);
+        test(s2 == arr[1]);
+    }
+
+    {
+        //
+        // The in-memory representation of a padded struct doesn't match
+        // its encoding, it must be marshaled member by member.
+        //
+        test(!Ice::IsBulkStreamable<PaddedStruct>::value);
+
+        PaddedStructS arr;
+        for(int i = 0; i < 4; ++i)
+        {
+            PaddedStruct s;
+            s.b = static_cast<Ice::Byte>(i);
+            s.d = 1.5 * i;
+            arr.push_back(s);
+        }
+        Ice::OutputStream out(communicator);
+        out.write(arr);
+        out.finished(data);
+        test(data.size() == 1 + arr.size() * 9);
+
+        Ice::OutputStream out2(communicator);
+        out2.write(arr[1].b);
+        out2.write(arr[1].d);
+        vector<Ice::Byte> data2;
+        out2.finished(data2);
+        test(data2.size() == 9);
+        test(equal(data2.begin(), data2.end(), data.begin() + 1 + 9));
+
+        Ice::InputStream in(communicator, data);
+        PaddedStructS arr2;
+        in.read(arr2);
+        test(arr2 == arr);
+    }
+
     {
         MyClassS arr;
         for(int i = 0; i < 4; ++i)
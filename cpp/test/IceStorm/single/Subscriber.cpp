@@ -9,21 +9,64 @@
 
 #include <Ice/Ice.h>
 #include <IceStorm/IceStorm.h>
+#include <IceStorm/Metrics.h>
 #include <Single.h>
 #include <TestCommon.h>
 
+#include <set>
+
 using namespace std;
 using namespace Ice;
 using namespace IceStorm;
 using namespace Test;
 
+//
+// Dispatches the received messages one at a time and numbers them, this
+// allows a subscriber to check if events were received in the same
+// batch.
+//
+class MessageDispatcher : public Ice::Dispatcher
+{
+public:
+
+    MessageDispatcher() :
+        _message(0)
+    {
+    }
+
+    virtual void
+    dispatch(const DispatcherCallPtr& call, const ConnectionPtr&)
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        ++_message;
+        call->run();
+    }
+
+    //
+    // Must be called from a dispatch.
+    //
+    int
+    message() const
+    {
+        return _message;
+    }
+
+private:
+
+    IceUtil::Mutex _mutex;
+    int _message;
+};
+typedef IceUtil::Handle<MessageDispatcher> MessageDispatcherPtr;
+
 class SingleI : public Single, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
 
-    SingleI(const CommunicatorPtr& communicator, const string& name) :
+    SingleI(const CommunicatorPtr& communicator, const string& name,
+            const MessageDispatcherPtr& dispatcher = MessageDispatcherPtr()) :
         _communicator(communicator),
         _name(name),
+        _dispatcher(dispatcher),
         _count(0),
         _last(0)
     {
@@ -32,8 +75,8 @@ public:
     virtual void
     event(int i, const Current& current)
     {
-        if((_name == "default" || _name == "oneway" || _name == "batch" || _name == "datagram" ||
-            _name == "batch datagram") && current.requestId != 0)
+        if((_name == "default" || _name == "oneway" || _name == "oneway burst" || _name == "batch" ||
+            _name == "datagram" || _name == "batch datagram") && current.requestId != 0)
         {
             cerr << endl << "expected oneway request";
             test(false);
@@ -53,6 +96,10 @@ public:
             test(false);
         }
         Lock sync(*this);
+        if(_dispatcher)
+        {
+            _messages.insert(_dispatcher->message());
+        }
         ++_last;
         if(++_count == 1000)
         {
@@ -89,6 +136,11 @@ public:
                 }
             }
         }
+        if(_dispatcher && _messages.size() == static_cast<size_t>(_count))
+        {
+            cerr << endl << "expected events to be received in batches";
+            test(false);
+        }
         cout << "ok" << endl;
     }
 
@@ -96,13 +148,323 @@ private:
 
     CommunicatorPtr _communicator;
     const string _name;
+    const MessageDispatcherPtr _dispatcher;
     int _count;
     int _last;
+    set<int> _messages;
 };
 typedef IceUtil::Handle<SingleI> SingleIPtr;
 
+//
+// Records the value of the events it receives, in order.
+//
+class EventRecorderI : public Ice::Blobject, public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    virtual bool
+    ice_invoke(const vector<Byte>& inParams, vector<Byte>&, const Current& current)
+    {
+        InputStream in(current.adapter->getCommunicator(), inParams);
+        in.startEncapsulation();
+        int i;
+        in.read(i);
+        in.endEncapsulation();
+
+        Lock sync(*this);
+        _events.push_back(i);
+        notifyAll();
+        return true;
+    }
+
+    vector<int>
+    waitForEvents(size_t count)
+    {
+        Lock sync(*this);
+        while(_events.size() < count)
+        {
+            if(!timedWait(IceUtil::Time::seconds(20)))
+            {
+                test(false);
+            }
+        }
+        return _events;
+    }
+
+private:
+
+    vector<int> _events;
+};
+typedef IceUtil::Handle<EventRecorderI> EventRecorderIPtr;
+
+//
+// Publishes an event with the given operation and value.
+//
+void
+publish(const ObjectPrx& publisher, const string& operation, int i, const Context& ctx = Context())
+{
+    OutputStream out(publisher->ice_getCommunicator());
+    out.startEncapsulation();
+    out.write(i);
+    out.endEncapsulation();
+    vector<Byte> inParams;
+    out.finished(inParams);
+
+    vector<Byte> outParams;
+    publisher->ice_invoke(operation, Normal, inParams, outParams, ctx);
+}
+
+void
+testFilter(const CommunicatorPtr& communicator, const TopicManagerPrx& manager)
+{
+    cout << "testing filters... " << flush;
+
+    TopicPrx topic = manager->create("filter");
+    ObjectPrx publisher = topic->getPublisher()->ice_twoway();
+    ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("FilterAdapter", "default");
+    adapter->activate();
+
+    IceStorm::QoS qos;
+    qos["reliability"] = "ordered";
+    qos["filter.operation"] = "event";
+    EventRecorderIPtr byOperation = new EventRecorderI;
+    topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(byOperation));
+
+    qos.erase("filter.operation");
+    qos["filter.context.color"] = "red";
+    EventRecorderIPtr byContext = new EventRecorderI;
+    topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(byContext));
+
+    Context red;
+    red["color"] = "red";
+    Context blue;
+    blue["color"] = "blue";
+
+    publish(publisher, "other", 1);
+    publish(publisher, "event", 2);
+    publish(publisher, "event", 3, blue);
+    publish(publisher, "event", 4, red);
+    publish(publisher, "other", 5, red);
+    publish(publisher, "event", 6, red);
+
+    //
+    // The last event matches both filters, the events received before
+    // it are all the matching events.
+    //
+    vector<int> events = byOperation->waitForEvents(4);
+    test(events.size() == 4 && events[0] == 2 && events[1] == 3 && events[2] == 4 && events[3] == 6);
+
+    events = byContext->waitForEvents(3);
+    test(events.size() == 3 && events[0] == 4 && events[1] == 5 && events[2] == 6);
+
+    topic->destroy();
+    adapter->destroy();
+
+    cout << "ok" << endl;
+}
+
+void
+testConflation(const CommunicatorPtr& communicator, const TopicManagerPrx& manager)
+{
+    cout << "testing conflation... " << flush;
+
+    TopicPrx topic = manager->create("conflation");
+    ObjectPrx publisher = topic->getPublisher()->ice_twoway();
+
+    //
+    // The subscriber adapter is activated once all the events are
+    // published. The first event is outstanding until then, the next
+    // events are queued and conflated by their "symbol" context value.
+    //
+    ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("ConflationAdapter", "default");
+    IceStorm::QoS qos;
+    qos["reliability"] = "ordered";
+    qos["conflate"] = "symbol";
+    EventRecorderIPtr recorder = new EventRecorderI;
+    topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(recorder));
+
+    Context a;
+    a["symbol"] = "a";
+    Context b;
+    b["symbol"] = "b";
+    Context c;
+    c["symbol"] = "c";
+
+    publish(publisher, "event", 1, a);
+    publish(publisher, "event", 2, a);
+    publish(publisher, "event", 3, b);
+    publish(publisher, "event", 4, a);
+    publish(publisher, "event", 5, b);
+    publish(publisher, "event", 6, c);
+    publish(publisher, "event", 7);
+
+    adapter->activate();
+
+    //
+    // Only the newest queued event of each symbol is sent, in the
+    // position of the first queued event of the symbol. Events without
+    // a symbol aren't conflated.
+    //
+    vector<int> events = recorder->waitForEvents(5);
+    test(events.size() == 5 && events[0] == 1 && events[1] == 4 && events[2] == 5 && events[3] == 6 &&
+         events[4] == 7);
+
+    topic->destroy();
+    adapter->destroy();
+
+    cout << "ok" << endl;
+}
+
+void
+testReplay(const CommunicatorPtr& communicator, const TopicManagerPrx& manager)
+{
+    cout << "testing replay... " << flush;
+
+    TopicPrx topic = manager->create("replay");
+    SinglePrx publisher = SinglePrx::uncheckedCast(topic->getPublisher()->ice_twoway());
+    ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("ReplayAdapter", "default");
+    adapter->activate();
+
+    for(int i = 0; i < 20; ++i)
+    {
+        publisher->event(i);
+    }
+
+    //
+    // The topic keeps the last 10 events (Replay.SizeMax). The events
+    // requested with the replay QoS are sent in order, before the events
+    // published after the subscription.
+    //
+    IceStorm::QoS qos;
+    qos["reliability"] = "ordered";
+    qos["replay"] = "5";
+    EventRecorderIPtr last = new EventRecorderI;
+    topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(last));
+
+    qos["replay"] = "100";
+    EventRecorderIPtr all = new EventRecorderI;
+    topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(all));
+
+    qos.erase("replay");
+    EventRecorderIPtr none = new EventRecorderI;
+    topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(none));
+
+    publisher->event(20);
+
+    vector<int> events = last->waitForEvents(6);
+    test(events.size() == 6);
+    for(int i = 0; i < 6; ++i)
+    {
+        test(events[i] == 15 + i);
+    }
+
+    events = all->waitForEvents(11);
+    test(events.size() == 11);
+    for(int i = 0; i < 11; ++i)
+    {
+        test(events[i] == 10 + i);
+    }
+
+    events = none->waitForEvents(1);
+    test(events.size() == 1 && events[0] == 20);
+
+    //
+    // Events older than Replay.Timeout aren't replayed.
+    //
+    IceUtil::ThreadControl::sleep(IceUtil::Time::seconds(5));
+    qos["replay"] = "100";
+    EventRecorderIPtr expired = new EventRecorderI;
+    topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(expired));
+
+    publisher->event(21);
+
+    events = expired->waitForEvents(1);
+    test(events.size() == 1 && events[0] == 21);
+
+    topic->destroy();
+    adapter->destroy();
+
+    cout << "ok" << endl;
+}
+
+void
+testMetrics(const CommunicatorPtr& communicator, const TopicManagerPrx& manager, const string& metricsAdmin)
+{
+    cout << "testing subscriber metrics... " << flush;
+
+    IceMX::MetricsAdminPrx admin = IceMX::MetricsAdminPrx::checkedCast(communicator->stringToProxy(metricsAdmin));
+    test(admin);
+
+    TopicPrx topic = manager->create("metrics");
+    ObjectPrx publisher = topic->getPublisher()->ice_twoway();
+
+    //
+    // The subscriber adapter is activated once the events are queued
+    // for a while, the first event is outstanding and the next events
+    // are queued until then.
+    //
+    ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("MetricsAdapter", "default");
+    IceStorm::QoS qos;
+    qos["reliability"] = "ordered";
+    EventRecorderIPtr recorder = new EventRecorderI;
+    ObjectPrx subscriber = adapter->addWithUUID(recorder);
+    topic->subscribeAndGetPublisher(qos, subscriber);
+
+    for(int i = 0; i < 5; ++i)
+    {
+        publish(publisher, "event", i);
+    }
+
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+    adapter->activate();
+    test(recorder->waitForEvents(5).size() == 5);
+
+    //
+    // The subscriber metrics are grouped by identity in the Subscribers
+    // view. The delivery is recorded once IceStorm gets the replies.
+    //
+    const string id = communicator->identityToString(subscriber->ice_getIdentity());
+    IceMX::SubscriberMetricsPtr metrics;
+    for(int i = 0; i < 100; ++i)
+    {
+        Ice::Long timestamp;
+        IceMX::MetricsView view = admin->getMetricsView("Subscribers", timestamp);
+        IceMX::MetricsView::const_iterator p = view.find("Subscriber");
+        test(p != view.end());
+        metrics = 0;
+        for(IceMX::MetricsMap::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+        {
+            if((*q)->id == id)
+            {
+                metrics = IceMX::SubscriberMetricsPtr::dynamicCast(*q);
+            }
+        }
+        test(metrics);
+        if(metrics->delivered == 5)
+        {
+            break;
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+    }
+    test(metrics->delivered == 5);
+    test(metrics->queued == 0 && metrics->outstanding == 0);
+    test(metrics->queuedMax && *metrics->queuedMax >= 4);
+
+    //
+    // Each event waited at least until the adapter activation.
+    //
+    test(metrics->deliveryTimeMax && *metrics->deliveryTimeMax >= 100000);
+    test(metrics->deliveryTime && *metrics->deliveryTime >= 5 * 100000);
+    test(*metrics->deliveryTime >= *metrics->deliveryTimeMax);
+
+    topic->destroy();
+    adapter->destroy();
+
+    cout << "ok" << endl;
+}
+
 int
-run(int, char* argv[], const CommunicatorPtr& communicator)
+run(int, char* argv[], const CommunicatorPtr& communicator, const MessageDispatcherPtr& dispatcher)
 {
     PropertiesPtr properties = communicator->getProperties();
     const char* managerProxyProperty = "IceStormAdmin.TopicManager.Default";
@@ -183,6 +545,30 @@ run(int, char* argv[], const CommunicatorPtr& communicator)
         subscriberIdentities.push_back(object->ice_getIdentity());
         topic->subscribeAndGetPublisher(IceStorm::QoS(), object);
     }
+    //
+    // The adapter of the burst subscriber is activated once the previous
+    // subscribers received their events, IceStorm queues the events
+    // meanwhile and must send them in batches. The dispatcher numbers the
+    // received messages to check it.
+    //
+    ObjectAdapterPtr burstAdapter = communicator->createObjectAdapterWithEndpoints("BurstAdapter", "default");
+    SingleIPtr burst = new SingleI(communicator, "oneway burst", dispatcher);
+    {
+        subscribers.push_back(burst);
+        IceStorm::QoS qos;
+        qos["burst"] = "1";
+        Ice::ObjectPrx object = burstAdapter->addWithUUID(subscribers.back())->ice_oneway();
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        subscribers.push_back(new SingleI(communicator, "filtered"));
+        IceStorm::QoS qos;
+        qos["filter.operation"] = "event";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
     {
         subscribers.push_back(new SingleI(communicator, "twoway"));
         Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back());
@@ -237,9 +623,30 @@ run(int, char* argv[], const CommunicatorPtr& communicator)
 
     for(vector<SingleIPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
     {
+        if(*p == burst)
+        {
+            burstAdapter->activate();
+        }
         (*p)->waitForEvents();
     }
 
+    testFilter(communicator, manager);
+    testConflation(communicator, manager);
+
+    //
+    // The replicas only replay the events they published themselves.
+    //
+    if(string(argv[1]) != "replicated")
+    {
+        testReplay(communicator, manager);
+    }
+
+    string metricsAdmin = properties->getProperty("IceStormAdmin.MetricsAdmin");
+    if(!metricsAdmin.empty())
+    {
+        testMetrics(communicator, manager, metricsAdmin);
+    }
+
     return EXIT_SUCCESS;
 }
 
@@ -251,8 +658,12 @@ main(int argc, char* argv[])
 
     try
     {
-        communicator = initialize(argc, argv);
-        status = run(argc, argv, communicator);
+        MessageDispatcherPtr dispatcher = new MessageDispatcher;
+        InitializationData initData;
+        initData.properties = createProperties(argc, argv);
+        initData.dispatcher = dispatcher;
+        communicator = initialize(argc, argv, initData);
+        status = run(argc, argv, communicator, dispatcher);
     }
     catch(const Exception& ex)
     {
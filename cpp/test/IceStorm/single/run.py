@@ -34,6 +34,20 @@ subscriber = os.path.join(os.getcwd(), TestUtil.getTestExecutable("subscriber"))
 iceStormArgs = " --Ice.UDP.SndSize=4096"
 subscriberArgs = " --Ice.UDP.RcvSize=4096"
 
+#
+# Keep the last 10 events of a topic for at most 4 seconds for the
+# replay test.
+#
+iceStormArgs += " --IceStorm.Replay.SizeMax=10 --IceStorm.Replay.Timeout=4"
+
+#
+# Group the subscriber metrics by identity for the metrics test and the
+# slowest command. The metrics admin facet of the IceStorm service is
+# only checked with the non-replicated deployments.
+#
+iceStormArgs += " --IceMX.Metrics.Subscribers.Map.Subscriber.GroupBy=identity"
+metricsAdmin = ' --IceStormAdmin.MetricsAdmin="IceBox12010/admin -f IceBox.Service.IceStorm.Metrics:default -p 12010"'
+
 targets = []
 if TestUtil.appverifier:
     targets = [TestUtil.getIceBox(), publisher, subscriber, TestUtil.getIceBoxAdmin(), TestUtil.getIceStormAdmin()]
@@ -50,7 +64,10 @@ def dotest(type):
 
     sys.stdout.write("starting subscriber... ")
     sys.stdout.flush()
-    subscriberProc = TestUtil.startServer(subscriber, icestorm.reference() + subscriberArgs + " " + type, count = 3)
+    args = icestorm.reference() + subscriberArgs
+    if type != "replicated":
+        args += metricsAdmin
+    subscriberProc = TestUtil.startServer(subscriber, args + " " + type, count = 3)
     print("ok")
 
     #
@@ -66,6 +83,13 @@ def dotest(type):
     subscriberProc.waitTestSuccess()
     publisherProc.waitTestSuccess()
 
+    if type != "replicated":
+        sys.stdout.write("testing slowest command... ")
+        sys.stdout.flush()
+        icestorm.adminWithRef(icestorm.reference() + metricsAdmin, "slowest Subscribers 1",
+                              expect = "average latency: .*ms")
+        print("ok")
+
     #
     # Destroy the topic.
     #
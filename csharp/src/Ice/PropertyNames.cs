@@ -85,6 +85,7 @@ namespace IceInternal
              new Property(@"^Ice\.Config$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.EncodingVersion$", false, null),
              new Property(@"^Ice\.Default\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Default\.Host$", false, null),
@@ -149,6 +150,7 @@ namespace IceInternal
              new Property(@"^Ice\.SOCKSProxyPort$", false, null),
              new Property(@"^Ice\.StdErr$", false, null),
              new Property(@"^Ice\.StdOut$", false, null),
+             new Property(@"^Ice\.StringConverter\.SkipASCII$", false, null),
              new Property(@"^Ice\.SyslogFacility$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.SizeMax$", false, null),
@@ -1015,6 +1017,7 @@ namespace IceInternal
              new Property(@"^IceStormAdmin\.TopicManager\.[^\s]+$", false, null),
              new Property(@"^IceStormAdmin\.Host$", false, null),
              new Property(@"^IceStormAdmin\.Port$", false, null),
+             new Property(@"^IceStormAdmin\.MetricsAdmin$", false, null),
              null
         };
 
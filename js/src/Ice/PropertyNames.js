@@ -86,6 +86,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Config/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
+    new Property("/^Ice\.Default\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Host/", false, null),
@@ -150,6 +151,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.SOCKSProxyPort/", false, null),
     new Property("/^Ice\.StdErr/", false, null),
     new Property("/^Ice\.StdOut/", false, null),
+    new Property("/^Ice\.StringConverter\.SkipASCII/", false, null),
     new Property("/^Ice\.SyslogFacility/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.SizeMax/", false, null),